@@ -4,26 +4,14 @@ unsigned int Greedy::approx_solve(const std::vector<Pallet> &pallets,
                                   const Truck &truck,
                                   std::vector<Pallet> &used_pallets,
                                   std::string &message,
-                                  unsigned int timeout_ms) {
+                                  unsigned int timeout_ms,
+                                  const CancellationToken *cancel) {
   auto start_time = std::chrono::high_resolution_clock::now();
-  auto timeout = std::chrono::milliseconds(timeout_ms);
+  SolveBudget budget(timeout_ms, cancel);
 
   // Sort pallets by profit-to-weight ratio in descending order
   std::vector<Pallet> sorted_pallets = pallets;
-  std::sort(
-      sorted_pallets.begin(), sorted_pallets.end(),
-      [](const Pallet& a, const Pallet& b) {
-        double ratio_a = (double)a.get_profit() / a.get_weight();
-        double ratio_b = (double)b.get_profit() / b.get_weight();
-        if (ratio_a == ratio_b) {
-          if (a.get_profit() == b.get_profit()) {
-            return a.get_id() < b.get_id(); // Lexicographical order by ID
-          }
-          return a.get_profit() >
-                 b.get_profit();  // Larger profits first if ratios are the same
-        }
-        return ratio_a > ratio_b;
-      });
+  std::sort(sorted_pallets.begin(), sorted_pallets.end(), ratio_order);
 
   unsigned int total_profit = 0;
   unsigned int remaining_weight = truck.get_capacity();
@@ -31,10 +19,11 @@ unsigned int Greedy::approx_solve(const std::vector<Pallet> &pallets,
 
   // Select pallets greedily
   for (const auto& pallet : sorted_pallets) {
-    auto now = std::chrono::high_resolution_clock::now();
-    if (now - start_time > timeout) {
-      message = "[Greedy] Timeout: Algorithm exceeded " +
-                std::to_string(timeout_ms) + " ms.";
+    if (budget.tick()) {
+      message = budget.is_cancelled()
+                    ? "[Greedy] " + budget.stop_reason()
+                    : "[Greedy] Timeout: Algorithm exceeded " +
+                          std::to_string(timeout_ms) + " ms.";
       return 0;
     }
     if (pallet.get_weight() <= remaining_weight) {
@@ -53,3 +42,19 @@ unsigned int Greedy::approx_solve(const std::vector<Pallet> &pallets,
 
   return total_profit;
 }
+
+bool Greedy::ratio_order(const Pallet &a, const Pallet &b) {
+  // a.profit / a.weight vs b.profit / b.weight, without rounding
+  unsigned long long lhs =
+      static_cast<unsigned long long>(a.get_profit()) * b.get_weight();
+  unsigned long long rhs =
+      static_cast<unsigned long long>(b.get_profit()) * a.get_weight();
+  if (lhs == rhs) {
+    if (a.get_profit() == b.get_profit()) {
+      return a.get_id() < b.get_id(); // Lexicographical order by ID
+    }
+    return a.get_profit() >
+           b.get_profit(); // Larger profits first if ratios are the same
+  }
+  return lhs > rhs;
+}
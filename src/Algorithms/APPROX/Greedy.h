@@ -7,6 +7,7 @@
 
 #include "../../DataStructures/Pallet.h"
 #include "../../DataStructures/Truck.h"
+#include "../SolveBudget.h"
 
 /*
 
@@ -42,6 +43,7 @@ class Greedy {
     * @param used_pallets Output: selected pallets
     * @param message Output: status and timing info
     * @param timeout_ms Timeout in milliseconds
+    * @param cancel Optional token to stop the solve from another thread
     * @return Total profit of selected pallets
     * @details
     * Time complexity: O(n log n)
@@ -50,7 +52,19 @@ class Greedy {
    unsigned int approx_solve(const std::vector<Pallet> &pallets,
                              const Truck &truck,
                              std::vector<Pallet> &used_pallets,
-                             std::string &message, unsigned int timeout_ms);
+                             std::string &message, unsigned int timeout_ms,
+                             const CancellationToken *cancel = nullptr);
+
+   /**
+    * @brief Ratio ordering used by the greedy selection: higher
+    * profit-to-weight ratio first, then higher profit, then smaller ID.
+    * @param a First pallet
+    * @param b Second pallet
+    * @return True if a comes before b
+    * @note Ratios are compared exactly (cross-multiplied integers), so the
+    * order is a strict weak ordering that bounds can rely on.
+    */
+   static bool ratio_order(const Pallet &a, const Pallet &b);
 };
 
 #endif  // GREEDY_H
@@ -1,28 +1,34 @@
 #include "BranchAndBound.h"
 
+#include "../REDUCTION/InstanceReduction.h"
+
 // Greedy upper bound estimation using fractional knapsack
 double BranchAndBound::estimate_upper_bound(const std::vector<Pallet> &pallets,
                                             unsigned int index,
                                             unsigned int curr_weight,
                                             unsigned int curr_value,
                                             unsigned int max_weight,
-                                            bool force_ratio_sort) {
+                                            bool force_ratio_sort,
+                                            SolveArena &arena) {
   double bound = curr_value;
   unsigned int weight = curr_weight;
 
   if (force_ratio_sort) {
-    std::vector<const Pallet *> remaining;
-    remaining.reserve(pallets.size() - index);
+    // Scratch order of the remaining pallets, given back on return
+    SolveArena::Scope scope(arena);
+    std::size_t count = pallets.size() - index;
+    const Pallet **remaining = arena.allocate<const Pallet *>(count);
     for (unsigned int i = index; i < pallets.size(); ++i)
-      remaining.push_back(&pallets[i]);
+      remaining[i - index] = &pallets[i];
 
-    std::sort(remaining.begin(), remaining.end(),
+    std::sort(remaining, remaining + count,
               [](const Pallet *a, const Pallet *b) {
                 return (double)a->get_profit() / a->get_weight() >
                        (double)b->get_profit() / b->get_weight();
               });
 
-    for (const auto &p : remaining) {
+    for (std::size_t r = 0; r < count; ++r) {
+      const Pallet *p = remaining[r];
       if (weight + p->get_weight() <= max_weight) {
         weight += p->get_weight();
         bound += p->get_profit();
@@ -54,13 +60,10 @@ void BranchAndBound::bb_helper(const std::vector<Pallet> &pallets,
                                unsigned int curr_value, unsigned int max_weight,
                                std::vector<bool> &curr_used,
                                std::vector<bool> &best_used,
-                               unsigned int &best_value,
-                               std::chrono::steady_clock::time_point deadline,
-                               bool &timed_out, bool force_ratio_sort) {
-  if (timed_out || std::chrono::steady_clock::now() > deadline) {
-    timed_out = true;
+                               unsigned int &best_value, SolveBudget &budget,
+                               SolveArena &arena, bool force_ratio_sort) {
+  if (budget.tick())
     return;
-  }
 
   if (curr_weight > max_weight)
     return;
@@ -79,40 +82,50 @@ void BranchAndBound::bb_helper(const std::vector<Pallet> &pallets,
         pallets.begin() + index + 1, pallets.end(), [&](const Pallet &p) {
           return p.get_weight() >= pallets[index].get_weight();
         });
-    if (all_heavier)
+    // Nothing else fits: the current selection is complete
+    if (all_heavier) {
+      if (curr_value > best_value) {
+        best_value = curr_value;
+        best_used = curr_used;
+      }
       return;
+    }
   }
 
   if (estimate_upper_bound(pallets, index, curr_weight, curr_value, max_weight,
-                           force_ratio_sort) <= best_value)
+                           force_ratio_sort, arena) <= best_value)
     return;
 
   // Include current pallet
   curr_used[index] = true;
   bb_helper(pallets, index + 1, curr_weight + pallets[index].get_weight(),
             curr_value + pallets[index].get_profit(), max_weight, curr_used,
-            best_used, best_value, deadline, timed_out, force_ratio_sort);
+            best_used, best_value, budget, arena, force_ratio_sort);
 
   // Exclude current pallet
   curr_used[index] = false;
   bb_helper(pallets, index + 1, curr_weight, curr_value, max_weight, curr_used,
-            best_used, best_value, deadline, timed_out, force_ratio_sort);
+            best_used, best_value, budget, arena, force_ratio_sort);
 }
 
 unsigned int BranchAndBound::bb_solve(std::vector<Pallet> pallets,
                                       const Truck &truck,
                                       std::vector<Pallet> &used_pallets,
                                       std::string &message,
-                                      unsigned int timeout_ms) {
+                                      unsigned int timeout_ms,
+                                      const CancellationToken *cancel) {
   auto start_time = std::chrono::steady_clock::now();
   auto half_timeout = timeout_ms / 2;
-  auto truck_capacity = truck.get_capacity();
-  bool timed_out = false;
+  SolveBudget budget(half_timeout, cancel);
+  SolveArena arena;
+  InstanceReduction reduction(pallets, truck.get_capacity());
+  std::vector<Pallet> items = reduction.get_pallets();
+  auto truck_capacity = reduction.get_capacity();
 
   // Analyze pallet set
   double total_value = 0, max_value = 0;
   unsigned int max_weight = 0;
-  for (const auto &p : pallets) {
+  for (const auto &p : items) {
     total_value += p.get_profit();
     if (p.get_profit() > max_value) {
       max_value = p.get_profit();
@@ -132,10 +145,10 @@ unsigned int BranchAndBound::bb_solve(std::vector<Pallet> pallets,
   };
 
   std::string sort_method = value_first ? "value" : "ratio";
-  std::sort(pallets.begin(), pallets.end(),
+  std::sort(items.begin(), items.end(),
             value_first ? sort_by_value : sort_by_ratio);
 
-  unsigned int n = pallets.size();
+  unsigned int n = items.size();
   std::vector<bool> curr_used(n, false), best_used(n, false);
   unsigned int best_value = 0;
 
@@ -143,9 +156,9 @@ unsigned int BranchAndBound::bb_solve(std::vector<Pallet> pallets,
   unsigned int greedy_value = 0, greedy_weight = 0;
   std::vector<bool> greedy_used(n, false);
   for (unsigned int i = 0; i < n; ++i) {
-    if (greedy_weight + pallets[i].get_weight() <= truck_capacity) {
-      greedy_weight += pallets[i].get_weight();
-      greedy_value += pallets[i].get_profit();
+    if (greedy_weight + items[i].get_weight() <= truck_capacity) {
+      greedy_weight += items[i].get_weight();
+      greedy_value += items[i].get_profit();
       greedy_used[i] = true;
     }
   }
@@ -154,56 +167,66 @@ unsigned int BranchAndBound::bb_solve(std::vector<Pallet> pallets,
     best_used = greedy_used;
   }
 
-  auto deadline = start_time + std::chrono::milliseconds(half_timeout);
   bool force_ratio_sort = value_first;
 
-  bb_helper(pallets, 0, 0, 0, truck_capacity, curr_used, best_used, best_value,
-            deadline, timed_out, force_ratio_sort);
+  bb_helper(items, 0, 0, 0, truck_capacity, curr_used, best_used, best_value,
+            budget, arena, force_ratio_sort);
 
   used_pallets.clear();
   for (unsigned int i = 0; i < n; ++i)
     if (best_used[i])
-      used_pallets.push_back(pallets[i]);
+      used_pallets.push_back(items[i]);
+  reduction.restore(used_pallets);
 
   auto end_time = std::chrono::steady_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
                       end_time - start_time)
                       .count();
 
-  if (!timed_out) {
+  if (!budget.is_exhausted()) {
     message = "[BB] Execution time: " + std::to_string(duration) +
-              " μs (sort: " + sort_method + ")";
-    return best_value;
+              " μs (sort: " + sort_method + ")" + reduction.describe() +
+              arena.describe();
+    return best_value + reduction.get_fixed_profit();
+  }
+  if (budget.is_cancelled()) {
+    message = "[BB] " + budget.stop_reason();
+    used_pallets.clear();
+    return 0;
   }
 
   // Retry with alternative sorting
   std::string alt_sort_method = value_first ? "ratio" : "value";
-  std::sort(pallets.begin(), pallets.end(),
+  std::sort(items.begin(), items.end(),
             value_first ? sort_by_ratio : sort_by_value);
 
   curr_used.assign(n, false);
   best_used.assign(n, false);
   best_value = 0;
   used_pallets.clear();
-  timed_out = false;
 
   auto retry_start = std::chrono::steady_clock::now();
-  auto retry_deadline = retry_start + std::chrono::milliseconds(half_timeout);
+  budget.restart(half_timeout);
   force_ratio_sort = !value_first;
 
-  bb_helper(pallets, 0, 0, 0, truck_capacity, curr_used, best_used, best_value,
-            retry_deadline, timed_out, force_ratio_sort);
+  bb_helper(items, 0, 0, 0, truck_capacity, curr_used, best_used, best_value,
+            budget, arena, force_ratio_sort);
 
   for (unsigned int i = 0; i < n; ++i)
     if (best_used[i])
-      used_pallets.push_back(pallets[i]);
+      used_pallets.push_back(items[i]);
 
   auto retry_end = std::chrono::steady_clock::now();
   auto retry_duration = std::chrono::duration_cast<std::chrono::microseconds>(
                             retry_end - retry_start)
                             .count();
 
-  if (timed_out) {
+  if (budget.is_cancelled()) {
+    message = "[BB] " + budget.stop_reason();
+    used_pallets.clear();
+    return 0;
+  }
+  if (budget.is_exhausted()) {
     message = "[BB] Timeout after both sort strategies (" +
               std::to_string(timeout_ms) +
               " ms total). Initial sort: " + sort_method +
@@ -212,8 +235,10 @@ unsigned int BranchAndBound::bb_solve(std::vector<Pallet> pallets,
     return 0;
   }
 
+  reduction.restore(used_pallets);
   message = "[BB] Execution time: " + std::to_string(retry_duration) +
             " μs (used alternative sort: " + alt_sort_method +
-            ", initial sort: " + sort_method + ")";
-  return best_value;
+            ", initial sort: " + sort_method + ")" + reduction.describe() +
+            arena.describe();
+  return best_value + reduction.get_fixed_profit();
 }
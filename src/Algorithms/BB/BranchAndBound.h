@@ -3,6 +3,8 @@
 
 #include "../../DataStructures/Pallet.h"
 #include "../../DataStructures/Truck.h"
+#include "../SolveArena.h"
+#include "../SolveBudget.h"
 #include <algorithm>
 #include <chrono>
 #include <string>
@@ -26,7 +28,8 @@ public:
    * @param truck Truck (capacity)
    * @param used_pallets Output: selected pallets
    * @param message Output: status and timing info
-   * @param timeout_ms Timeout in milliseconds
+   * @param timeout_ms Timeout in milliseconds (half per sort strategy)
+   * @param cancel Optional token to stop the solve from another thread
    * @return Maximum profit
    * @details
    * Time complexity: O(2^n) worst case, but usually much less due to pruning.
@@ -34,7 +37,8 @@ public:
    */
   unsigned int bb_solve(std::vector<Pallet> pallets, const Truck &truck,
                         std::vector<Pallet> &used_pallets, std::string &message,
-                        unsigned int timeout_ms);
+                        unsigned int timeout_ms,
+                        const CancellationToken *cancel = nullptr);
 
 private:
   /**
@@ -46,12 +50,13 @@ private:
    * @param curr_value Current total value
    * @param max_weight Maximum capacity
    * @param force_ratio_sort Whether to sort by ratio for the upper bound
+   * @param arena Scratch memory for the sorted remaining pallets
    * @return Upper bound on achievable value
    */
   double estimate_upper_bound(const std::vector<Pallet> &pallets,
                               unsigned int index, unsigned int curr_weight,
                               unsigned int curr_value, unsigned int max_weight,
-                              bool force_ratio_sort);
+                              bool force_ratio_sort, SolveArena &arena);
   /**
    * @brief Helper function for recursive branch-and-bound.
    * @param pallets List of pallets
@@ -62,16 +67,16 @@ private:
    * @param curr_used Current selection vector
    * @param best_used Best selection vector
    * @param best_value Best value found so far
-   * @param deadline Timeout deadline
-   * @param timed_out Set to true if timeout occurs
+   * @param budget Time and cancellation budget (one tick per node)
+   * @param arena Scratch memory of the solve
    * @param force_ratio_sort Whether to sort by ratio for the upper bound
    */
   void bb_helper(const std::vector<Pallet> &pallets, unsigned int index,
                  unsigned int curr_weight, unsigned int curr_value,
                  unsigned int max_weight, std::vector<bool> &curr_used,
                  std::vector<bool> &best_used, unsigned int &best_value,
-                 std::chrono::steady_clock::time_point deadline,
-                 bool &timed_out, bool force_ratio_sort);
+                 SolveBudget &budget, SolveArena &arena,
+                 bool force_ratio_sort);
 };
 
 #endif // BRANCH_AND_BOUND_H
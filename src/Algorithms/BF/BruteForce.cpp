@@ -1,5 +1,7 @@
 #include "BruteForce.h"
 
+#include "../REDUCTION/InstanceReduction.h"
+
 // Simple backtracking helper (no upper bound, no sorting)
 void BruteForce::bt_helper(const std::vector<Pallet> &pallets,
                            unsigned int index, unsigned int curr_weight,
@@ -7,29 +9,26 @@ void BruteForce::bt_helper(const std::vector<Pallet> &pallets,
                            std::vector<bool> &curr_used,
                            std::vector<bool> &best_used,
                            unsigned int &best_value, unsigned int &best_weight,
-                           unsigned int &best_count,
-                           std::chrono::steady_clock::time_point deadline,
-                           bool &timed_out) {
-  if (timed_out)
-    return;
-  if (std::chrono::steady_clock::now() > deadline) {
-    timed_out = true;
+                           unsigned int &best_count, SolveBudget &budget,
+                           SolveArena &arena) {
+  if (budget.tick())
     return;
-  }
   if (curr_weight > max_weight)
     return;
   if (index == pallets.size()) {
+    // Both selections in order, for the tie-break; given back on return
+    SolveArena::Scope scope(arena);
+    const Pallet **curr_pallets =
+        arena.allocate<const Pallet *>(pallets.size());
+    const Pallet **best_pallets =
+        arena.allocate<const Pallet *>(pallets.size());
     unsigned int curr_count = 0;
-    std::vector<Pallet> curr_pallets;
-    std::vector<Pallet> best_pallets;
+    unsigned int best_size = 0;
     for (unsigned int i = 0; i < pallets.size(); ++i) {
-      if (curr_used[i]) {
-        curr_count++;
-        curr_pallets.push_back(pallets[i]);
-      }
-      if (best_used[i]) {
-        best_pallets.push_back(pallets[i]);
-      }
+      if (curr_used[i])
+        curr_pallets[curr_count++] = &pallets[i];
+      if (best_used[i])
+        best_pallets[best_size++] = &pallets[i];
     }
     if (curr_value > best_value ||
         (curr_value == best_value && curr_weight < best_weight) ||
@@ -37,7 +36,7 @@ void BruteForce::bt_helper(const std::vector<Pallet> &pallets,
          curr_count < best_count) ||
         (curr_value == best_value && curr_weight == best_weight &&
          curr_count == best_count &&
-         is_lex_smaller(curr_pallets, best_pallets))) {
+         is_lex_smaller(curr_pallets, curr_count, best_pallets, best_size))) {
       best_value = curr_value;
       best_weight = curr_weight;
       best_count = curr_count;
@@ -49,90 +48,98 @@ void BruteForce::bt_helper(const std::vector<Pallet> &pallets,
   curr_used[index] = true;
   bt_helper(pallets, index + 1, curr_weight + pallets[index].get_weight(),
             curr_value + pallets[index].get_profit(), max_weight, curr_used,
-            best_used, best_value, best_weight, best_count, deadline,
-            timed_out);
+            best_used, best_value, best_weight, best_count, budget, arena);
   // Exclude current pallet
   curr_used[index] = false;
   bt_helper(pallets, index + 1, curr_weight, curr_value, max_weight, curr_used,
-            best_used, best_value, best_weight, best_count, deadline,
-            timed_out);
+            best_used, best_value, best_weight, best_count, budget, arena);
 }
 
 unsigned int BruteForce::bt_solve(std::vector<Pallet> pallets,
                                   const Truck &truck,
                                   std::vector<Pallet> &used_pallets,
                                   std::string &message,
-                                  unsigned int timeout_ms) {
+                                  unsigned int timeout_ms,
+                                  const CancellationToken *cancel) {
   auto start_time = std::chrono::steady_clock::now();
-  bool timed_out = false;
-  unsigned int n = pallets.size();
+  SolveBudget budget(timeout_ms, cancel);
+  SolveArena arena;
+  // Ties are broken by the ids of the selection: only remove pallets
+  InstanceReduction reduction(pallets, truck.get_capacity(), false);
+  const std::vector<Pallet> &items = reduction.get_pallets();
+  unsigned int n = items.size();
   std::vector<bool> curr_used(n, false);
   std::vector<bool> best_used(n, false);
   unsigned int best_value = 0;
   unsigned int best_weight = UINT_MAX;
   unsigned int best_count = UINT_MAX;
-  unsigned int truck_capacity = truck.get_capacity();
-  auto deadline = start_time + std::chrono::milliseconds(timeout_ms);
+  unsigned int truck_capacity = reduction.get_capacity();
 
-  bt_helper(pallets, 0, 0, 0, truck_capacity, curr_used, best_used, best_value,
-            best_weight, best_count, deadline, timed_out);
+  bt_helper(items, 0, 0, 0, truck_capacity, curr_used, best_used, best_value,
+            best_weight, best_count, budget, arena);
 
   // Collect the used pallets
   used_pallets.clear();
   for (unsigned int i = 0; i < n; ++i) {
     if (best_used[i]) {
-      used_pallets.push_back(pallets[i]);
+      used_pallets.push_back(items[i]);
     }
   }
+  reduction.restore(used_pallets);
 
   auto end_time = std::chrono::steady_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
                       end_time - start_time)
                       .count();
 
-  if (timed_out) {
+  if (budget.is_exhausted()) {
     used_pallets.clear();
-    message = "[BF (BT)] Timeout after " + std::to_string(timeout_ms) + " ms.";
+    message = "[BF (BT)] " + budget.stop_reason();
     return 0;
   }
 
-  message = "[BF (BT)] Execution time: " + std::to_string(duration) + " μs";
-  return best_value;
+  message = "[BF (BT)] Execution time: " + std::to_string(duration) + " μs" +
+            reduction.describe() + arena.describe();
+  return best_value + reduction.get_fixed_profit();
 }
 
 unsigned int BruteForce::bf_solve(const std::vector<Pallet> &pallets,
                                   const Truck &truck,
                                   std::vector<Pallet> &used_pallets,
                                   std::string &message,
-                                  unsigned int timeout_ms) {
+                                  unsigned int timeout_ms,
+                                  const CancellationToken *cancel) {
   auto start_time = std::chrono::steady_clock::now();
-  auto deadline = start_time + std::chrono::milliseconds(timeout_ms);
-  bool timed_out = false;
+  SolveBudget budget(timeout_ms, cancel);
+  SolveArena arena;
 
-  unsigned int n = pallets.size();
-  unsigned int max_weight = truck.get_capacity();
+  // Ties are broken by the ids of the selection: only remove pallets
+  InstanceReduction reduction(pallets, truck.get_capacity(), false);
+  const std::vector<Pallet> &items = reduction.get_pallets();
+  unsigned int n = items.size();
+  unsigned int max_weight = reduction.get_capacity();
   unsigned int best_value = 0;
   unsigned int best_weight = UINT_MAX;
   unsigned int best_count = UINT_MAX;
-  std::vector<Pallet> best_pallets;
+  // Selections as pointers into items, allocated once for every subset
+  const Pallet **current_pallets = arena.allocate<const Pallet *>(n);
+  const Pallet **best_pallets = arena.allocate<const Pallet *>(n);
+  unsigned int best_size = 0;
 
   // Iterate through all possible subsets (2^n subsets)
   uint64_t total_subsets = 1ULL << n;
   for (uint64_t subset = 0; subset < total_subsets; ++subset) {
-    if (std::chrono::steady_clock::now() > deadline) {
-      timed_out = true;
+    // Each subset costs O(n)
+    if (budget.tick(n + 1))
       break;
-    }
     unsigned int curr_weight = 0;
     unsigned int curr_value = 0;
     unsigned int curr_count = 0;
-    std::vector<Pallet> current_pallets;
     for (unsigned int i = 0; i < n; ++i) {
       if (subset & (1ULL << i)) {
-        curr_weight += pallets[i].get_weight();
-        curr_value += pallets[i].get_profit();
-        curr_count++;
-        current_pallets.push_back(pallets[i]);
+        curr_weight += items[i].get_weight();
+        curr_value += items[i].get_profit();
+        current_pallets[curr_count++] = &items[i];
       }
     }
     if (curr_weight <= max_weight) {
@@ -142,50 +149,54 @@ unsigned int BruteForce::bf_solve(const std::vector<Pallet> &pallets,
            curr_count < best_count) ||
           (curr_value == best_value && curr_weight == best_weight &&
            curr_count == best_count &&
-           is_lex_smaller(current_pallets, best_pallets))) {
+           is_lex_smaller(current_pallets, curr_count, best_pallets,
+                          best_size))) {
         best_value = curr_value;
         best_weight = curr_weight;
         best_count = curr_count;
-        best_pallets = current_pallets;
+        std::copy(current_pallets, current_pallets + curr_count, best_pallets);
+        best_size = curr_count;
       }
     }
   }
 
   // Store the best pallets
-  used_pallets = best_pallets;
+  used_pallets.clear();
+  for (unsigned int k = 0; k < best_size; ++k)
+    used_pallets.push_back(*best_pallets[k]);
+  reduction.restore(used_pallets);
 
   auto end_time = std::chrono::steady_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
                       end_time - start_time)
                       .count();
 
-  if (timed_out) {
+  if (budget.is_exhausted()) {
     used_pallets.clear();
-    message = "[BF] Timeout after " + std::to_string(timeout_ms) + " ms.";
+    message = "[BF] " + budget.stop_reason();
     return 0;
   }
 
-  message = "[BF] Execution time: " + std::to_string(duration) + " μs";
-  return best_value;
+  message = "[BF] Execution time: " + std::to_string(duration) + " μs" +
+            reduction.describe() + arena.describe();
+  return best_value + reduction.get_fixed_profit();
 }
 
 /**
- * @brief Lexicographical comparison of two vectors of Pallets by their IDs.
- * @param a First vector of pallets
- * @param b Second vector of pallets
+ * @brief Lexicographical comparison of two selections by their pallet IDs.
+ * @param a First selection (pallets in order of inclusion)
+ * @param a_count Number of pallets in a
+ * @param b Second selection
+ * @param b_count Number of pallets in b
  * @return true if a is lexicographically smaller than b
  */
-bool BruteForce::is_lex_smaller(const std::vector<Pallet> &a,
-                                const std::vector<Pallet> &b) const {
-  std::vector<std::string> ids_a;
-  std::vector<std::string> ids_b;
-  ids_a.reserve(a.size());
-  ids_b.reserve(b.size());
-  for (const auto &p : a)
-    ids_a.push_back(p.get_id());
-  for (const auto &p : b)
-    ids_b.push_back(p.get_id());
+bool BruteForce::is_lex_smaller(const Pallet *const *a, unsigned int a_count,
+                                const Pallet *const *b,
+                                unsigned int b_count) const {
   // Do NOT sort: preserve order of inclusion for correct lexicographical
   // comparison
-  return ids_a < ids_b;
+  return std::lexicographical_compare(a, a + a_count, b, b + b_count,
+                                      [](const Pallet *x, const Pallet *y) {
+                                        return x->get_id() < y->get_id();
+                                      });
 }
@@ -10,6 +10,8 @@
 
 #include "../../DataStructures/Pallet.h"
 #include "../../DataStructures/Truck.h"
+#include "../SolveArena.h"
+#include "../SolveBudget.h"
 
 /**
  * @class BruteForce
@@ -30,6 +32,7 @@ class BruteForce {
     * @param used_pallets Output: selected pallets
     * @param message Output: status and timing info
     * @param timeout_ms Timeout in milliseconds
+    * @param cancel Optional token to stop the solve from another thread
     * @return Maximum profit
     * @details
     * Time complexity: O(2^n) (worst case)
@@ -37,7 +40,8 @@ class BruteForce {
     */
    unsigned int bt_solve(std::vector<Pallet> pallets, const Truck &truck,
                          std::vector<Pallet> &used_pallets,
-                         std::string &message, unsigned int timeout_ms);
+                         std::string &message, unsigned int timeout_ms,
+                         const CancellationToken *cancel = nullptr);
 
    /**
     * @brief Solves the knapsack problem using brute force (explicit subset
@@ -47,6 +51,7 @@ class BruteForce {
     * @param used_pallets Output: selected pallets
     * @param message Output: status and timing info
     * @param timeout_ms Timeout in milliseconds
+    * @param cancel Optional token to stop the solve from another thread
     * @return Maximum profit
     * @details
     * Time complexity: O(2^n * n)
@@ -54,7 +59,8 @@ class BruteForce {
     */
    unsigned int bf_solve(const std::vector<Pallet> &pallets, const Truck &truck,
                          std::vector<Pallet> &used_pallets,
-                         std::string &message, unsigned int timeout_ms);
+                         std::string &message, unsigned int timeout_ms,
+                         const CancellationToken *cancel = nullptr);
 
  private:
    /**
@@ -69,16 +75,15 @@ class BruteForce {
     * @param best_value Best value found so far
     * @param best_weight Best weight found so far (for tie-breaking)
     * @param best_count Best count found so far (for tie-breaking)
-    * @param deadline Timeout deadline
-    * @param timed_out Set to true if timeout occurs
+    * @param budget Time and cancellation budget (one tick per node)
+    * @param arena Scratch memory for the selections compared at each leaf
     */
    void bt_helper(const std::vector<Pallet> &pallets, unsigned int index,
                   unsigned int curr_weight, unsigned int curr_value,
                   unsigned int max_weight, std::vector<bool> &curr_used,
                   std::vector<bool> &best_used, unsigned int &best_value,
                   unsigned int &best_weight, unsigned int &best_count,
-                  std::chrono::steady_clock::time_point deadline,
-                  bool &timed_out);
+                  SolveBudget &budget, SolveArena &arena);
 
    /**
     * @brief Estimates an upper bound for the current subproblem (optional, for
@@ -96,13 +101,15 @@ class BruteForce {
                                unsigned int max_weight);
 
    /**
-    * @brief Lexicographical comparison of two vectors of Pallets by their IDs.
-    * @param a First vector of pallets
-    * @param b Second vector of pallets
+    * @brief Lexicographical comparison of two selections by their pallet IDs.
+    * @param a First selection (pallets in order of inclusion)
+    * @param a_count Number of pallets in a
+    * @param b Second selection
+    * @param b_count Number of pallets in b
     * @return true if a is lexicographically smaller than b
     */
-   bool is_lex_smaller(const std::vector<Pallet> &a,
-                       const std::vector<Pallet> &b) const;
+   bool is_lex_smaller(const Pallet *const *a, unsigned int a_count,
+                       const Pallet *const *b, unsigned int b_count) const;
 };
 
 #endif  // BRUTE_FORCE_H
@@ -0,0 +1,348 @@
+#include "DPKernels.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DP_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace DPKernels {
+namespace {
+// Scalar update of capacities [weight, hi], from high to low.
+template <class Cell>
+void add_item_scalar(Cell *row, long long hi, unsigned int weight,
+                     Cell profit) {
+  for (long long w = hi; w >= static_cast<long long>(weight); --w) {
+    Cell include = static_cast<Cell>(row[w - weight] + profit);
+    if (include > row[w])
+      row[w] = include;
+  }
+}
+
+// Scalar update of packed keys for cells [lo, hi) of one word, from base.
+std::uint64_t add_item_packed_cells(const std::int64_t *prev,
+                                    std::int64_t *curr, std::size_t lo,
+                                    std::size_t hi, std::size_t base,
+                                    unsigned int weight, std::int64_t key) {
+  std::uint64_t word = 0;
+  for (std::size_t w = lo; w < hi; w++) {
+    std::int64_t include = prev[w - weight] + key;
+    if (include >= prev[w]) {
+      curr[w] = include;
+      word |= std::uint64_t(1) << (w - base);
+    } else {
+      curr[w] = prev[w];
+    }
+  }
+  return word;
+}
+
+void add_item_packed_scalar(const std::int64_t *prev, std::int64_t *curr,
+                            std::size_t cols, unsigned int weight,
+                            std::int64_t key, std::size_t k_lo,
+                            std::size_t k_hi, std::uint64_t *taken) {
+  for (std::size_t k = k_lo; k < k_hi; k++) {
+    std::size_t base = k * 64;
+    std::size_t end = std::min(base + 64, cols);
+    // Cells below the weight keep the previous key and a 0 bit
+    std::size_t start = std::min(std::max<std::size_t>(base, weight), end);
+    std::memcpy(curr + base, prev + base, (start - base) * sizeof(*curr));
+    taken[k] =
+        add_item_packed_cells(prev, curr, start, end, base, weight, key);
+  }
+}
+
+// Scalar update of reachability word k: ws whole words and bs bits of shift
+void add_item_reach_word(std::uint64_t *bits, std::size_t k, std::size_t ws,
+                         unsigned int bs, std::uint64_t mask,
+                         unsigned int item, unsigned int *first_item) {
+  std::uint64_t shifted = bits[k - ws] << bs;
+  if (bs && k > ws)
+    shifted |= bits[k - ws - 1] >> (64 - bs);
+  std::uint64_t fresh = shifted & ~bits[k] & mask;
+  bits[k] |= fresh;
+  for (; fresh; fresh &= fresh - 1)
+    first_item[k * 64 + __builtin_ctzll(fresh)] = item;
+}
+
+#ifdef DP_KERNELS_X86
+// Each block loads both operands before storing, so the overlapping reads
+// of a block (when weight < lanes) still see the previous row.
+__attribute__((target("avx2"))) void
+add_item_avx2(unsigned int *row, unsigned int max_weight, unsigned int weight,
+              unsigned int profit) {
+  const __m256i p = _mm256_set1_epi32(static_cast<int>(profit));
+  long long hi = max_weight;
+  for (; hi - 7 >= static_cast<long long>(weight); hi -= 8) {
+    unsigned int *dst = row + hi - 7;
+    __m256i keep = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst));
+    __m256i take = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i *>(dst - weight));
+    take = _mm256_add_epi32(take, p);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst),
+                        _mm256_max_epu32(keep, take));
+  }
+  add_item_scalar(row, hi, weight, profit);
+}
+
+__attribute__((target("sse4.1"))) void
+add_item_sse41(unsigned int *row, unsigned int max_weight, unsigned int weight,
+               unsigned int profit) {
+  const __m128i p = _mm_set1_epi32(static_cast<int>(profit));
+  long long hi = max_weight;
+  for (; hi - 3 >= static_cast<long long>(weight); hi -= 4) {
+    unsigned int *dst = row + hi - 3;
+    __m128i keep = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst));
+    __m128i take =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst - weight));
+    take = _mm_add_epi32(take, p);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst),
+                     _mm_max_epu32(keep, take));
+  }
+  add_item_scalar(row, hi, weight, profit);
+}
+
+// 16-bit cells: twice the lanes of the 32-bit kernels
+__attribute__((target("avx2"))) void
+add_item_avx2(std::uint16_t *row, unsigned int max_weight, unsigned int weight,
+              std::uint16_t profit) {
+  const __m256i p = _mm256_set1_epi16(static_cast<short>(profit));
+  long long hi = max_weight;
+  for (; hi - 15 >= static_cast<long long>(weight); hi -= 16) {
+    std::uint16_t *dst = row + hi - 15;
+    __m256i keep = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst));
+    __m256i take = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i *>(dst - weight));
+    take = _mm256_add_epi16(take, p);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst),
+                        _mm256_max_epu16(keep, take));
+  }
+  add_item_scalar(row, hi, weight, profit);
+}
+
+__attribute__((target("sse4.1"))) void
+add_item_sse41(std::uint16_t *row, unsigned int max_weight,
+               unsigned int weight, std::uint16_t profit) {
+  const __m128i p = _mm_set1_epi16(static_cast<short>(profit));
+  long long hi = max_weight;
+  for (; hi - 7 >= static_cast<long long>(weight); hi -= 8) {
+    std::uint16_t *dst = row + hi - 7;
+    __m128i keep = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst));
+    __m128i take =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst - weight));
+    take = _mm_add_epi16(take, p);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst),
+                     _mm_max_epu16(keep, take));
+  }
+  add_item_scalar(row, hi, weight, profit);
+}
+
+// 64-bit cells: AVX2 has no unsigned 64-bit max, but cells stay below 2^63,
+// so a signed compare and a blend do
+__attribute__((target("avx2"))) void
+add_item_avx2(std::uint64_t *row, unsigned int max_weight, unsigned int weight,
+              std::uint64_t profit) {
+  const __m256i p = _mm256_set1_epi64x(static_cast<long long>(profit));
+  long long hi = max_weight;
+  for (; hi - 3 >= static_cast<long long>(weight); hi -= 4) {
+    std::uint64_t *dst = row + hi - 3;
+    __m256i keep = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst));
+    __m256i take = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i *>(dst - weight));
+    take = _mm256_add_epi64(take, p);
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i *>(dst),
+        _mm256_blendv_epi8(keep, take, _mm256_cmpgt_epi64(take, keep)));
+  }
+  add_item_scalar(row, hi, weight, profit);
+}
+
+// 4 x 64-bit lanes: a signed compare gives "exclude strictly better", whose
+// sign bits (movemask) are the complement of the taken bits.
+__attribute__((target("avx2"))) void
+add_item_packed_avx2(const std::int64_t *prev, std::int64_t *curr,
+                     std::size_t cols, unsigned int weight, std::int64_t key,
+                     std::size_t k_lo, std::size_t k_hi,
+                     std::uint64_t *taken) {
+  const __m256i k4 = _mm256_set1_epi64x(key);
+  for (std::size_t k = k_lo; k < k_hi; k++) {
+    std::size_t base = k * 64;
+    std::size_t end = std::min(base + 64, cols);
+    std::size_t start = std::min(std::max<std::size_t>(base, weight), end);
+    std::memcpy(curr + base, prev + base, (start - base) * sizeof(*curr));
+    std::uint64_t word = 0;
+    std::size_t w = start;
+    for (; w + 4 <= end; w += 4) {
+      __m256i keep =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(prev + w));
+      __m256i take = _mm256_add_epi64(
+          _mm256_loadu_si256(
+              reinterpret_cast<const __m256i *>(prev + w - weight)),
+          k4);
+      __m256i worse = _mm256_cmpgt_epi64(keep, take);
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(curr + w),
+                          _mm256_blendv_epi8(take, keep, worse));
+      unsigned int mask =
+          ~_mm256_movemask_pd(_mm256_castsi256_pd(worse)) & 0xFu;
+      word |= static_cast<std::uint64_t>(mask) << (w - base);
+    }
+    taken[k] =
+        word | add_item_packed_cells(prev, curr, w, end, base, weight, key);
+  }
+}
+
+// 4 words per block; blocks without a newly reachable sum are skipped after
+// one test. A shift by 64 bits gives 0, so bs == 0 needs no special case.
+__attribute__((target("avx2"))) std::size_t
+add_item_reach_avx2(std::uint64_t *bits, std::size_t top, std::size_t ws,
+                    unsigned int bs, unsigned int item,
+                    unsigned int *first_item) {
+  const __m128i left = _mm_cvtsi32_si128(static_cast<int>(bs));
+  const __m128i right = _mm_cvtsi32_si128(static_cast<int>(64 - bs));
+  std::size_t k = top;
+  for (; k >= ws + 5; k -= 4) {
+    std::uint64_t *dst = bits + k - 3;
+    __m256i curr = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst));
+    __m256i high = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i *>(dst - ws));
+    __m256i low = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i *>(dst - ws - 1));
+    __m256i fresh = _mm256_andnot_si256(
+        curr, _mm256_or_si256(_mm256_sll_epi64(high, left),
+                              _mm256_srl_epi64(low, right)));
+    if (_mm256_testz_si256(fresh, fresh))
+      continue;
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst),
+                        _mm256_or_si256(curr, fresh));
+    alignas(32) std::uint64_t words[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(words), fresh);
+    for (std::size_t j = 0; j < 4; j++)
+      for (std::uint64_t word = words[j]; word; word &= word - 1)
+        first_item[(k - 3 + j) * 64 + __builtin_ctzll(word)] = item;
+  }
+  return k;
+}
+#endif
+} // namespace
+
+ISA detect_isa() {
+#ifdef DP_KERNELS_X86
+  static const ISA detected = []() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+      return ISA::AVX2;
+    if (__builtin_cpu_supports("sse4.1"))
+      return ISA::SSE41;
+    return ISA::Scalar;
+  }();
+  return detected;
+#else
+  return ISA::Scalar;
+#endif
+}
+
+std::string isa_name(ISA isa) {
+  switch (isa) {
+  case ISA::AVX2:
+    return "AVX2";
+  case ISA::SSE41:
+    return "SSE4.1";
+  default:
+    return "Scalar";
+  }
+}
+
+unsigned int cell_bits(unsigned long long profit_bound) {
+  if (profit_bound <= 0xFFFFu)
+    return 16;
+  if (profit_bound <= 0xFFFFFFFFu)
+    return 32;
+  return 64;
+}
+
+void add_item(std::uint16_t *row, unsigned int max_weight, unsigned int weight,
+              std::uint16_t profit, ISA isa) {
+  if (weight > max_weight)
+    return;
+#ifdef DP_KERNELS_X86
+  if (isa == ISA::AVX2)
+    return add_item_avx2(row, max_weight, weight, profit);
+  if (isa == ISA::SSE41)
+    return add_item_sse41(row, max_weight, weight, profit);
+#else
+  (void)isa;
+#endif
+  add_item_scalar(row, max_weight, weight, profit);
+}
+
+void add_item(unsigned int *row, unsigned int max_weight, unsigned int weight,
+              unsigned int profit, ISA isa) {
+  if (weight > max_weight)
+    return;
+#ifdef DP_KERNELS_X86
+  if (isa == ISA::AVX2)
+    return add_item_avx2(row, max_weight, weight, profit);
+  if (isa == ISA::SSE41)
+    return add_item_sse41(row, max_weight, weight, profit);
+#else
+  (void)isa;
+#endif
+  add_item_scalar(row, max_weight, weight, profit);
+}
+
+void add_item(std::uint64_t *row, unsigned int max_weight, unsigned int weight,
+              std::uint64_t profit, ISA isa) {
+  if (weight > max_weight)
+    return;
+#ifdef DP_KERNELS_X86
+  // SSE4.1 has no 64-bit compare, so it runs the scalar loop
+  if (isa == ISA::AVX2)
+    return add_item_avx2(row, max_weight, weight, profit);
+#else
+  (void)isa;
+#endif
+  add_item_scalar(row, max_weight, weight, profit);
+}
+
+void add_item_packed(const std::int64_t *prev, std::int64_t *curr,
+                     std::size_t cols, unsigned int weight, std::int64_t key,
+                     std::size_t k_lo, std::size_t k_hi, std::uint64_t *taken,
+                     ISA isa) {
+#ifdef DP_KERNELS_X86
+  if (isa == ISA::AVX2)
+    return add_item_packed_avx2(prev, curr, cols, weight, key, k_lo, k_hi,
+                                taken);
+#else
+  (void)isa;
+#endif
+  add_item_packed_scalar(prev, curr, cols, weight, key, k_lo, k_hi, taken);
+}
+void add_item_reach(std::uint64_t *bits, std::size_t cols, unsigned int weight,
+                    unsigned int item, unsigned int *first_item, ISA isa) {
+  if (weight == 0 || weight >= cols)
+    return;
+  std::size_t num_words = (cols + 63) / 64;
+  std::size_t ws = weight / 64;
+  unsigned int bs = weight % 64;
+  // The top word is partial: sums at or above cols are masked off
+  std::uint64_t top_mask =
+      cols % 64 ? (std::uint64_t(1) << (cols % 64)) - 1 : ~std::uint64_t(0);
+  std::size_t k = num_words - 1;
+  add_item_reach_word(bits, k, ws, bs, top_mask, item, first_item);
+  if (k == ws)
+    return;
+  k--;
+#ifdef DP_KERNELS_X86
+  if (isa == ISA::AVX2)
+    k = add_item_reach_avx2(bits, k, ws, bs, item, first_item);
+#else
+  (void)isa;
+#endif
+  for (; k + 1 > ws; k--) {
+    add_item_reach_word(bits, k, ws, bs, ~std::uint64_t(0), item, first_item);
+    if (k == 0)
+      break;
+  }
+}
+} // namespace DPKernels
@@ -0,0 +1,122 @@
+#ifndef DP_KERNELS_H
+#define DP_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @namespace DPKernels
+ * @brief Low-level single-array (rolling row) knapsack kernels.
+ *
+ * The row holds, for every capacity w in [0, max_weight], the best profit
+ * using the items added so far. Adding an item updates the row in place,
+ * from high to low capacities, so every read still sees the previous row:
+ *
+ *   row[w] = max(row[w], row[w - weight] + profit), for w >= weight
+ *
+ * Vectorized variants process several consecutive capacities per
+ * instruction: 16, 8 or 4 with AVX2 for 16-, 32- or 64-bit cells. The
+ * instruction set is chosen at runtime from what the CPU supports, and all
+ * variants produce identical rows.
+ */
+namespace DPKernels {
+/**
+ * @enum ISA
+ * @brief Instruction set used by the vectorized kernels.
+ */
+enum class ISA {
+  Scalar, ///< Portable scalar loop
+  SSE41,  ///< 4 x 32-bit lanes (SSE4.1)
+  AVX2    ///< 8 x 32-bit lanes (AVX2)
+};
+
+/**
+ * @brief Detects the best instruction set supported by the running CPU.
+ * @return ISA::AVX2, ISA::SSE41 or ISA::Scalar
+ */
+ISA detect_isa();
+
+/**
+ * @brief Human-readable name of an instruction set.
+ * @param isa Instruction set
+ * @return Name such as "AVX2"
+ */
+std::string isa_name(ISA isa);
+
+/**
+ * @brief Narrowest row cell that holds every profit up to a bound.
+ * @param profit_bound Upper bound of any row cell (e.g. the sum of profits)
+ * @return 16, 32 or 64 (bits per cell)
+ */
+unsigned int cell_bits(unsigned long long profit_bound);
+
+/**
+ * @brief Adds one item to a rolling row, in place (0/1 semantics). Rows come
+ * in three cell widths (see cell_bits()): 16-bit cells get twice the lanes
+ * of 32-bit ones, and 64-bit cells hold profit sums beyond 2^32.
+ * @param row Row of max_weight + 1 profits; every cell, plus profit, must
+ * fit the cell type (64-bit cells: below 2^63)
+ * @param max_weight Maximum capacity (last index of row)
+ * @param weight Item weight
+ * @param profit Item profit
+ * @param isa Instruction set to use (see detect_isa()); with 64-bit cells
+ * SSE4.1 has no 64-bit compare, so it runs the scalar loop
+ * @details
+ * Time complexity: O(W / lanes)
+ * Space complexity: O(1)
+ */
+void add_item(std::uint16_t *row, unsigned int max_weight, unsigned int weight,
+              std::uint16_t profit, ISA isa);
+void add_item(unsigned int *row, unsigned int max_weight, unsigned int weight,
+              unsigned int profit, ISA isa);
+void add_item(std::uint64_t *row, unsigned int max_weight, unsigned int weight,
+              std::uint64_t profit, ISA isa);
+
+/**
+ * @brief Adds one item to the 64-cell words [k_lo, k_hi) of a row of signed
+ * 64-bit keys (see PackedDrawKey), from prev into curr, and stores the
+ * "taken" bits of those words (include at least as good as exclude).
+ * @param prev Previous row (cols keys)
+ * @param curr Row to write (cols keys)
+ * @param cols Number of cells per row (max_weight + 1)
+ * @param weight Item weight
+ * @param key Item key (ignored if weight >= cols)
+ * @param k_lo First word to update
+ * @param k_hi One past the last word to update
+ * @param taken Decision words of this row (ceil(cols / 64) words)
+ * @param isa Instruction set to use (see detect_isa()); SSE4.1 has no 64-bit
+ * compare, so it runs the scalar loop
+ * @details
+ * Time complexity: O((k_hi - k_lo) * 64 / lanes)
+ * Space complexity: O(1)
+ */
+void add_item_packed(const std::int64_t *prev, std::int64_t *curr,
+                     std::size_t cols, unsigned int weight, std::int64_t key,
+                     std::size_t k_lo, std::size_t k_hi, std::uint64_t *taken,
+                     ISA isa);
+
+/**
+ * @brief Adds one item to a reachability bitset of subset sums, in place
+ * (bits |= bits << weight), and records the item as the first one reaching
+ * every sum that becomes reachable.
+ * @param bits Reachability words (bit s of word s / 64 is sum s), with no
+ * bit set at or above cols
+ * @param cols Number of sums (max_weight + 1)
+ * @param weight Item weight
+ * @param item Item index, stored for the newly reachable sums
+ * @param first_item Output: first item reaching each sum (cols entries)
+ * @param isa Instruction set to use (see detect_isa()); SSE4.1 runs the
+ * scalar loop
+ * @details
+ * Words are updated from high to low, so every read still sees the bitset
+ * before the item. Each sum is reached for the first time at most once, so
+ * recording first items costs O(W) over the whole instance.
+ * Time complexity: O(W / (64 * words per instruction)) + newly reached sums
+ * Space complexity: O(1)
+ */
+void add_item_reach(std::uint64_t *bits, std::size_t cols, unsigned int weight,
+                    unsigned int item, unsigned int *first_item, ISA isa);
+} // namespace DPKernels
+
+#endif // DP_KERNELS_H
@@ -0,0 +1,135 @@
+#ifndef DP_PACKED_KEY_H
+#define DP_PACKED_KEY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../../DataStructures/Pallet.h"
+#include "DPKernels.h"
+
+/**
+ * @class PackedDrawKey
+ * @brief Encodes a draw-condition entry (profit, weight, count) as one signed
+ * 64-bit key whose ordinary integer order is the draw order (maximum profit,
+ * then minimum weight, then minimum count):
+ *
+ *   key = profit * 2^(W + C) - weight * 2^C - count
+ *
+ * with C bits for counts up to n and W bits for weights up to the capacity,
+ * so weight * 2^C + count never borrows from the profit. Keys are additive:
+ * including a pallet adds its own key, and the empty entry is 0. The draw
+ * DP is then a plain max over 64-bit integers, like the profit-only DP.
+ *
+ * The layout fits when the largest key, total profit * 2^(W + C), stays
+ * below 2^63 and the total profit fits in an unsigned int; otherwise the DP
+ * must run on DPEntryDraw.
+ */
+class PackedDrawKey {
+private:
+  unsigned int count_bits = 0;  ///< C: bits of the largest count (n)
+  unsigned int weight_bits = 0; ///< W: bits of the largest weight (capacity)
+  unsigned int profit_bits = 0; ///< Bits of the total profit
+  bool fit = false;             ///< True if every key fits in 63 bits
+
+  static unsigned int bit_width(unsigned long long value) {
+    unsigned int bits = 0;
+    for (; value; value >>= 1)
+      bits++;
+    return bits;
+  }
+
+public:
+  /**
+   * @brief Construct a new PackedDrawKey object for one instance.
+   * @param pallets List of pallets
+   * @param max_weight Maximum capacity
+   */
+  PackedDrawKey(const std::vector<Pallet> &pallets, unsigned int max_weight) {
+    unsigned long long total_profit = 0;
+    for (const Pallet &p : pallets)
+      total_profit += p.get_profit();
+    count_bits = bit_width(pallets.size());
+    weight_bits = bit_width(max_weight);
+    profit_bits = bit_width(total_profit);
+    // Profits beyond 32 bits would not wrap like DPEntryDraw's
+    fit = profit_bits <= 32 && profit_bits + weight_bits + count_bits <= 63;
+  }
+
+  /**
+   * @brief Whether every key of the instance fits in a signed 64-bit integer.
+   * @return True if the packed DP can be used
+   */
+  bool fits() const { return fit; }
+
+  /**
+   * @brief Key of a single pallet, added to an entry to include it.
+   * @param p Pallet (its weight must not exceed the capacity)
+   * @return profit * 2^(W + C) - weight * 2^C - 1
+   */
+  std::int64_t item_key(const Pallet &p) const {
+    return (static_cast<std::int64_t>(p.get_profit())
+            << (weight_bits + count_bits)) -
+           (static_cast<std::int64_t>(p.get_weight()) << count_bits) - 1;
+  }
+
+  /**
+   * @brief Profit of an entry.
+   * @param key Entry key
+   * @return Profit (the key rounded up to a multiple of 2^(W + C))
+   */
+  unsigned int profit(std::int64_t key) const {
+    std::uint64_t below = (std::uint64_t(1) << (weight_bits + count_bits)) - 1;
+    return static_cast<unsigned int>(
+        (static_cast<std::uint64_t>(key) + below) >>
+        (weight_bits + count_bits));
+  }
+
+  /**
+   * @brief Pallet count of an entry.
+   * @param key Entry key
+   * @return Count (the low C bits below the rounded-up profit)
+   */
+  unsigned int count(std::int64_t key) const {
+    std::uint64_t above =
+        static_cast<std::uint64_t>(profit(key)) << (weight_bits + count_bits);
+    std::uint64_t rest = above - static_cast<std::uint64_t>(key);
+    return static_cast<unsigned int>(rest &
+                                     ((std::uint64_t(1) << count_bits) - 1));
+  }
+
+  /**
+   * @brief Describes the layout for result messages.
+   * @return " | Packed draw key: P + W + C bits"
+   */
+  std::string describe() const {
+    return " | Packed draw key: " + std::to_string(profit_bits) + " + " +
+           std::to_string(weight_bits) + " + " + std::to_string(count_bits) +
+           " bits";
+  }
+};
+
+/**
+ * @struct PackedDrawRowKernel
+ * @brief Row kernel of the draw-condition DP over packed keys, for the
+ * rolling-row engines (see PolicyRowKernel).
+ */
+struct PackedDrawRowKernel {
+  using Entry = std::int64_t;
+
+  const PackedDrawKey &key; ///< Layout of the instance
+  DPKernels::ISA isa;       ///< Instruction set of the row update
+
+  Entry empty() const { return 0; }
+  void update(const Entry *prev, Entry *curr, const Pallet &p,
+              std::size_t cols, std::size_t k_lo, std::size_t k_hi,
+              std::uint64_t *taken) const {
+    std::int64_t item = p.get_weight() < cols ? key.item_key(p) : 0;
+    DPKernels::add_item_packed(prev, curr, cols, p.get_weight(), item, k_lo,
+                               k_hi, taken, isa);
+  }
+  unsigned int profit(const Entry &entry) const { return key.profit(entry); }
+};
+
+#endif // DP_PACKED_KEY_H
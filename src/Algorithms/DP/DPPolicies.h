@@ -0,0 +1,201 @@
+#ifndef DP_POLICIES_H
+#define DP_POLICIES_H
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../DataStructures/Pallet.h"
+#include "DPEntry.h"
+#include "DPTable.h"
+
+/**
+ * @file DPPolicies.h
+ * @brief Compile-time entry policies for the templated DP kernels.
+ *
+ * Each policy exposes the concrete entry type and the operations the kernels
+ * need (empty/sentinel construction, include transition, ordering and
+ * equality) as static, non-virtual functions operating on entries by value.
+ * DynamicProgramming::dp_solve picks the policy once from the draw and
+ * lexicographical flags, so the per-cell path never goes through
+ * DPEntryBase's virtual interface.
+ */
+
+/**
+ * @struct SimplePolicy
+ * @brief Profit-only entries (draw_condition == false).
+ */
+struct SimplePolicy {
+  using Entry = DPSimpleEntry;
+
+  static Entry empty() { return Entry(0); }
+  static Entry not_computed() { return Entry(UINT_MAX); }
+  static bool is_computed(const Entry &e) { return e.profit != UINT_MAX; }
+  static Entry include(const Entry &base, const Pallet &p) {
+    return Entry(base.profit + p.get_profit());
+  }
+  static bool less(const Entry &a, const Entry &b) {
+    return a.profit < b.profit;
+  }
+  static bool equal(const Entry &a, const Entry &b) {
+    return a.profit == b.profit;
+  }
+};
+
+/**
+ * @struct DrawPolicy
+ * @brief Profit, weight and count entries (draw_condition == true,
+ * lexicographical_order == false).
+ */
+struct DrawPolicy {
+  using Entry = DPEntryDraw;
+
+  static Entry empty() { return Entry(0, 0, 0); }
+  static Entry not_computed() { return Entry(UINT_MAX, 0, 0); }
+  static bool is_computed(const Entry &e) { return e.profit != UINT_MAX; }
+  static Entry include(const Entry &base, const Pallet &p) {
+    return Entry(base.profit + p.get_profit(), base.weight + p.get_weight(),
+                 base.count + 1);
+  }
+  static bool less(const Entry &a, const Entry &b) {
+    if (a.profit != b.profit)
+      return a.profit < b.profit;
+    if (a.weight != b.weight)
+      return a.weight > b.weight;
+    return a.count > b.count;
+  }
+  static bool equal(const Entry &a, const Entry &b) {
+    return a.profit == b.profit && a.weight == b.weight && a.count == b.count;
+  }
+};
+
+/**
+ * @struct LexPolicy
+ * @brief Profit, weight, count and pallet id entries (draw_condition == true,
+ * lexicographical_order == true).
+ * @note The include transition copies the id vector, so this policy still
+ * allocates per cell. It is meant for small problems only.
+ */
+struct LexPolicy {
+  using Entry = DPEntryLex;
+
+  static Entry empty() { return Entry(0, 0, 0, {}); }
+  static Entry not_computed() { return Entry(UINT_MAX, 0, 0, {}); }
+  static bool is_computed(const Entry &e) { return e.profit != UINT_MAX; }
+  static Entry include(const Entry &base, const Pallet &p) {
+    Entry result(base.profit + p.get_profit(), base.weight + p.get_weight(),
+                 base.count + 1, base.ids);
+    result.ids.push_back(p.get_id());
+    return result;
+  }
+  static bool less(const Entry &a, const Entry &b) {
+    if (a.profit != b.profit)
+      return a.profit < b.profit;
+    if (a.weight != b.weight)
+      return a.weight > b.weight;
+    if (a.count != b.count)
+      return a.count > b.count;
+    return a.ids > b.ids;
+  }
+  static bool equal(const Entry &a, const Entry &b) {
+    return a.profit == b.profit && a.weight == b.weight && a.count == b.count &&
+           a.ids == b.ids;
+  }
+};
+
+/**
+ * @brief Updates the 64-cell words [k_lo, k_hi) of one rolling row and
+ * stores their "taken" bits (include at least as good as exclude).
+ * @param prev Previous row (cols entries)
+ * @param curr Row to write (cols entries)
+ * @param p Item of this row
+ * @param empty Policy::empty(), hoisted out of the loop
+ * @param cols Number of cells per row (max_weight + 1)
+ * @param k_lo First word to update
+ * @param k_hi One past the last word to update
+ * @param taken Decision words of this row (ceil(cols / 64) words)
+ */
+template <class Policy>
+void policy_row_update(const typename Policy::Entry *prev,
+                       typename Policy::Entry *curr, const Pallet &p,
+                       const typename Policy::Entry &empty, std::size_t cols,
+                       std::size_t k_lo, std::size_t k_hi,
+                       std::uint64_t *taken) {
+  using Entry = typename Policy::Entry;
+  std::size_t pw = p.get_weight();
+  for (std::size_t k = k_lo; k < k_hi; k++) {
+    std::size_t base = k * 64;
+    std::size_t end = std::min(base + 64, cols);
+    std::uint64_t word = 0;
+    for (std::size_t w = base; w < end; w++) {
+      if (w < pw) {
+        curr[w] = Policy::less(prev[w], empty) ? empty : prev[w];
+        continue;
+      }
+      Entry include = Policy::include(prev[w - pw], p);
+      if (Policy::less(prev[w], include)) {
+        curr[w] = include;
+        word |= std::uint64_t(1) << (w - base);
+      } else {
+        curr[w] = prev[w];
+        if (!Policy::less(include, prev[w]))
+          word |= std::uint64_t(1) << (w - base);
+      }
+    }
+    taken[k] = word;
+  }
+}
+
+/**
+ * @struct PolicyRowKernel
+ * @brief Row kernel of the rolling-row engines (DP Bitset, Parallel and
+ * Out-of-Core) for one entry policy.
+ *
+ * A row kernel names the entry type of the rows, the entry every row starts
+ * from, the update of a range of words of one row (with its "taken" bits)
+ * and the profit of an entry. PackedDrawRowKernel is the other row kernel.
+ */
+template <class Policy> struct PolicyRowKernel {
+  using Entry = typename Policy::Entry;
+
+  const Entry empty_entry = Policy::empty(); ///< Hoisted out of the rows
+
+  Entry empty() const { return empty_entry; }
+  void update(const Entry *prev, Entry *curr, const Pallet &p,
+              std::size_t cols, std::size_t k_lo, std::size_t k_hi,
+              std::uint64_t *taken) const {
+    policy_row_update<Policy>(prev, curr, p, empty_entry, cols, k_lo, k_hi,
+                              taken);
+  }
+  unsigned int profit(const Entry &entry) const { return entry.profit; }
+};
+
+/**
+ * @class PolymorphicTableView
+ * @brief Typed view over a polymorphic DPTable (VectorDPTable), giving it
+ * the same at()/put() interface as FlatDPTable.
+ *
+ * The kernels stay free of virtual entry operations; only the storage calls
+ * of this legacy table remain indirect (and put() still allocates, because
+ * the table owns its entries through unique_ptr).
+ */
+template <class Entry> class PolymorphicTableView {
+private:
+  DPTable &table; ///< Underlying polymorphic table
+
+public:
+  explicit PolymorphicTableView(DPTable &table) : table(table) {}
+
+  const Entry &at(unsigned int i, unsigned int w) const {
+    return static_cast<const Entry &>(table.get(i, w));
+  }
+  void put(unsigned int i, unsigned int w, const Entry &entry) {
+    table.set(i, w, std::make_unique<Entry>(entry));
+  }
+};
+
+#endif // DP_POLICIES_H
@@ -0,0 +1,81 @@
+#include "DPSession.h"
+#include <algorithm>
+
+template <class Policy>
+DPSession<Policy>::DPSession(const Truck &truck,
+                             unsigned int checkpoint_interval)
+    : max_weight(truck.get_capacity()),
+      cols(static_cast<std::size_t>(truck.get_capacity()) + 1),
+      words_per_row((cols + 63) / 64),
+      checkpoint_interval(std::max(1u, checkpoint_interval)),
+      row(cols, Policy::empty()), scratch(cols, Policy::empty()) {}
+
+template <class Policy> void DPSession<Policy>::push_row(std::size_t i) {
+  policy_row_update<Policy>(row.data(), scratch.data(), pallets[i],
+                            Policy::empty(), cols, 0, words_per_row,
+                            taken.data() + i * words_per_row);
+  std::swap(row, scratch);
+  rows_computed++;
+}
+
+template <class Policy>
+unsigned int DPSession<Policy>::add_pallet(const Pallet &pallet) {
+  pallets.push_back(pallet);
+  taken.resize(pallets.size() * words_per_row);
+  push_row(pallets.size() - 1);
+  if (pallets.size() % checkpoint_interval == 0)
+    checkpoints.push_back(row);
+  return get_profit();
+}
+
+template <class Policy> bool DPSession<Policy>::remove_last() {
+  if (pallets.empty())
+    return false;
+  if (pallets.size() % checkpoint_interval == 0)
+    checkpoints.pop_back();
+  pallets.pop_back();
+  taken.resize(pallets.size() * words_per_row);
+  // Replay the pallets after the nearest checkpoint; their decision bits are
+  // rewritten with the same values
+  std::size_t start = checkpoints.size() * checkpoint_interval;
+  if (checkpoints.empty())
+    std::fill(row.begin(), row.end(), Policy::empty());
+  else
+    row = checkpoints.back();
+  for (std::size_t i = start; i < pallets.size(); i++)
+    push_row(i);
+  return true;
+}
+
+template <class Policy>
+void DPSession<Policy>::get_used_pallets(
+    std::vector<Pallet> &used_pallets) const {
+  used_pallets.clear();
+  std::size_t i = pallets.size(), w = max_weight;
+  while (i > 0 && w > 0) {
+    const std::uint64_t *words = taken.data() + (i - 1) * words_per_row;
+    if ((words[w >> 6] >> (w & 63)) & 1) {
+      used_pallets.push_back(pallets[i - 1]);
+      w -= pallets[i - 1].get_weight();
+    }
+    i--;
+  }
+  std::reverse(used_pallets.begin(), used_pallets.end());
+}
+
+template <class Policy>
+std::size_t DPSession<Policy>::get_memory_usage() const {
+  return (2 + checkpoints.size()) * cols * sizeof(Entry) +
+         taken.capacity() * sizeof(std::uint64_t);
+}
+
+template <class Policy> std::string DPSession<Policy>::describe() const {
+  return " | Session: " + std::to_string(pallets.size()) + " pallets, " +
+         std::to_string(rows_computed) + " rows computed, " +
+         std::to_string(checkpoints.size()) + " checkpoints, " +
+         std::to_string(get_memory_usage()) + " B";
+}
+
+template class DPSession<SimplePolicy>;
+template class DPSession<DrawPolicy>;
+template class DPSession<LexPolicy>;
@@ -0,0 +1,126 @@
+#ifndef DP_SESSION_H
+#define DP_SESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../../DataStructures/Pallet.h"
+#include "../../DataStructures/Truck.h"
+#include "DPPolicies.h"
+
+/**
+ * @class DPSession
+ * @brief Incremental bottom-up DP over a growing list of pallets, for pallets
+ * that arrive one by one.
+ *
+ * Bottom-up rows are prefix-stable: row i only depends on the first i
+ * pallets. The session keeps the last row of entries and one row of "taken"
+ * bits per pallet (as DP Bitset does), so add_pallet() computes a single new
+ * row and the selection can be reconstructed at any time. Every
+ * checkpoint_interval pallets the row is also saved, so remove_last()
+ * recomputes at most checkpoint_interval - 1 rows from the nearest
+ * checkpoint instead of the whole list.
+ *
+ * The optimum and the selection are the ones dp_solve returns for the same
+ * list with item fixing off (same row update and tie-breaking).
+ *
+ * Templated on the entry policy (SimplePolicy, DrawPolicy, LexPolicy).
+ * Explicit instantiations are provided for these three policies.
+ *
+ * - add_pallet(): O(W) time
+ * - remove_last(): O(k * W) time, k = checkpoint_interval
+ * - get_used_pallets(): O(n) time
+ * - Space: O((n / k + 2) * W) entries + nW/8 bytes of decisions
+ */
+template <class Policy> class DPSession {
+public:
+  using Entry = typename Policy::Entry;
+
+private:
+  unsigned int max_weight;          ///< Truck capacity
+  std::size_t cols;                 ///< Cells per row (max_weight + 1)
+  std::size_t words_per_row;        ///< 64-bit decision words per row
+  unsigned int checkpoint_interval; ///< Pallets between saved rows
+  std::vector<Pallet> pallets;      ///< Pallets added so far, in order
+  std::vector<std::uint64_t> taken; ///< Decision words, one row per pallet
+  std::vector<Entry> row;           ///< Row after all pallets
+  std::vector<Entry> scratch;       ///< Next row while it is computed
+  /// Row after (j + 1) * checkpoint_interval pallets, for every j
+  std::vector<std::vector<Entry>> checkpoints;
+  std::size_t rows_computed = 0; ///< Rows computed since construction
+
+  /**
+   * @brief Computes the row of pallet i from the current row and stores its
+   * decision bits.
+   * @param i Index of the pallet in pallets
+   */
+  void push_row(std::size_t i);
+
+public:
+  /**
+   * @brief Construct a new, empty DPSession object.
+   * @param truck Truck (capacity)
+   * @param checkpoint_interval Pallets between saved rows (at least 1);
+   * lower values make remove_last() faster and use more memory
+   */
+  explicit DPSession(const Truck &truck, unsigned int checkpoint_interval = 16);
+
+  /**
+   * @brief Adds a pallet after the ones already in the session.
+   * @param pallet Pallet to add
+   * @return Maximum profit over all pallets added so far
+   * @details
+   * Time complexity: O(W)
+   */
+  unsigned int add_pallet(const Pallet &pallet);
+
+  /**
+   * @brief Removes the most recently added pallet.
+   * @return False if the session was empty
+   * @details
+   * Time complexity: O(k * W), k = checkpoint_interval
+   */
+  bool remove_last();
+
+  /**
+   * @brief Get the maximum profit over all pallets added so far.
+   * @return Maximum profit
+   */
+  unsigned int get_profit() const { return row[max_weight].get_profit(); }
+
+  /**
+   * @brief Reconstructs the selection of the current optimum.
+   * @param used_pallets Output: selected pallets, in order of arrival
+   * @details
+   * Time complexity: O(n)
+   */
+  void get_used_pallets(std::vector<Pallet> &used_pallets) const;
+
+  /**
+   * @brief Get the pallets added so far.
+   * @return Pallets in order of arrival
+   */
+  const std::vector<Pallet> &get_pallets() const { return pallets; }
+
+  /**
+   * @brief Get the number of pallets added so far.
+   * @return Number of pallets
+   */
+  std::size_t size() const { return pallets.size(); }
+
+  /**
+   * @brief Get the memory used by rows, checkpoints and decisions in bytes.
+   * @return Memory usage in bytes
+   */
+  std::size_t get_memory_usage() const;
+
+  /**
+   * @brief Summary of the session for result messages.
+   * @return Suffix such as " | Session: 120 pallets, 125 rows computed, ..."
+   */
+  std::string describe() const;
+};
+
+#endif // DP_SESSION_H
@@ -0,0 +1,133 @@
+#include "DecisionBitset.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define DECISION_BITSET_MMAP
+#endif
+
+DecisionBitset::DecisionBitset(std::size_t rows, std::size_t cols,
+                               bool zero_fill)
+    : words(new std::uint64_t[rows * ((cols + 63) / 64)]), rows(rows),
+      words_per_row((cols + 63) / 64) {
+  if (zero_fill)
+    std::fill(words, words + rows * words_per_row, 0);
+}
+
+#ifdef DECISION_BITSET_MMAP
+// Helper: error for a failed system call on the scratch file
+static std::runtime_error scratch_error(const std::string &what,
+                                        const std::string &path) {
+  return std::runtime_error("DecisionBitset: cannot " + what + " " + path +
+                            ": " + std::strerror(errno));
+}
+
+// Helper: allocates the file's blocks so that a full disk fails here, not
+// as SIGBUS when the mapping is written. Returns 0 or an errno value.
+static int reserve_blocks(int fd, std::size_t bytes) {
+#ifdef __linux__
+  int err = posix_fallocate(fd, 0, static_cast<off_t>(bytes));
+  // Filesystems without block allocation get a sparse file instead
+  if (err != EINVAL && err != EOPNOTSUPP)
+    return err;
+#endif
+  return ftruncate(fd, static_cast<off_t>(bytes)) == 0 ? 0 : errno;
+}
+
+DecisionBitset::DecisionBitset(std::size_t rows, std::size_t cols,
+                               const std::string &scratch_directory)
+    : rows(rows), words_per_row((cols + 63) / 64) {
+  std::filesystem::path dir =
+      scratch_directory.empty() ? std::filesystem::temp_directory_path()
+                                : std::filesystem::path(scratch_directory);
+  std::string path = (dir / "packing-dp-XXXXXX").string();
+  std::vector<char> name(path.begin(), path.end());
+  name.push_back('\0');
+  int fd = mkstemp(name.data());
+  if (fd < 0)
+    throw scratch_error("create a scratch file in", dir.string());
+  path = name.data();
+  // The name is not needed once the file is open
+  unlink(name.data());
+  // At least one byte: mmap rejects empty mappings
+  std::size_t bytes = std::max<std::size_t>(get_memory_usage(), 1);
+  if (int err = reserve_blocks(fd, bytes)) {
+    close(fd);
+    errno = err;
+    throw scratch_error("allocate " + std::to_string(bytes) + " bytes for",
+                        path);
+  }
+  void *map = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED) {
+    close(fd);
+    throw scratch_error("map", path);
+  }
+  words = static_cast<std::uint64_t *>(map);
+  mapped_bytes = bytes;
+  this->fd = fd;
+}
+
+DecisionBitset::~DecisionBitset() {
+  if (is_mapped()) {
+    munmap(words, mapped_bytes);
+    close(fd);
+  } else {
+    delete[] words;
+  }
+}
+
+void DecisionBitset::rows_completed(std::size_t end_row) {
+  if (!is_mapped())
+    return;
+  static const std::size_t page =
+      static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  std::size_t done = end_row * words_per_row * sizeof(std::uint64_t);
+  // Only whole pages can be released; the last partial one stays dirty
+  done -= done % page;
+  if (done < written_bytes + WRITEBACK_CHUNK && end_row < rows)
+    return;
+  if (done <= written_bytes)
+    return;
+  auto *begin = reinterpret_cast<char *>(words) + written_bytes;
+  std::size_t length = done - written_bytes;
+  // Write the chunk back, then drop it: later reads page it in from disk
+  msync(begin, length, MS_SYNC);
+  madvise(begin, length, MADV_DONTNEED);
+  written_bytes = done;
+}
+
+bool DecisionBitset::read(std::size_t row, std::size_t w) const {
+  if (!is_mapped())
+    return test(row, w);
+  // One word from the file, without mapping the pages around it back in
+  std::uint64_t word = 0;
+  off_t offset = static_cast<off_t>((row * words_per_row + (w >> 6)) *
+                                    sizeof(std::uint64_t));
+  if (pread(fd, &word, sizeof(word), offset) != sizeof(word))
+    throw std::runtime_error(std::string("DecisionBitset: cannot read ") +
+                             "the scratch file: " + std::strerror(errno));
+  return (word >> (w & 63)) & 1;
+}
+#else
+DecisionBitset::DecisionBitset(std::size_t rows, std::size_t cols,
+                               const std::string &)
+    : rows(rows), words_per_row((cols + 63) / 64) {
+  throw std::runtime_error(
+      "DecisionBitset: memory-mapped scratch files need a POSIX system");
+}
+
+DecisionBitset::~DecisionBitset() { delete[] words; }
+
+void DecisionBitset::rows_completed(std::size_t) {}
+
+bool DecisionBitset::read(std::size_t row, std::size_t w) const {
+  return test(row, w);
+}
+#endif
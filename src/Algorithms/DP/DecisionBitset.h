@@ -0,0 +1,148 @@
+#ifndef DECISION_BITSET_H
+#define DECISION_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class DecisionBitset
+ * @brief Packed matrix of "taken" bits, one per (row, capacity) cell, used to
+ * reconstruct a DP solution without keeping the full table of entries.
+ *
+ * Each row is padded to a whole number of 64-bit words, so a row of
+ * (max_weight + 1) cells takes ceil((max_weight + 1) / 64) * 8 bytes.
+ *
+ * The bits live either on the heap or, for instances whose decisions do not
+ * fit in RAM, in a memory-mapped scratch file (out-of-core). The file is
+ * unlinked as soon as it is created, so it disappears with the bitset even if
+ * the process dies. Rows are written in order: rows_completed() writes the
+ * finished rows back to disk in chunks and drops them from memory, and read()
+ * fetches single words from the file while the solution is reconstructed.
+ */
+class DecisionBitset {
+public:
+  /// Finished rows are written back and dropped once this many bytes pile up
+  static constexpr std::size_t WRITEBACK_CHUNK = std::size_t(64) << 20;
+
+private:
+  std::uint64_t *words = nullptr; ///< Row-major packed bits
+  std::size_t rows = 0;           ///< Number of rows
+  std::size_t words_per_row = 0;  ///< 64-bit words per row
+  std::size_t mapped_bytes = 0;   ///< Size of the file mapping (0: heap)
+  std::size_t written_bytes = 0;  ///< Prefix of the mapping written back
+  int fd = -1;                    ///< Scratch file descriptor (mapped only)
+
+public:
+  /**
+   * @brief Construct a new DecisionBitset object on the heap.
+   * @param rows Number of rows (one per item)
+   * @param cols Number of cells per row (max_weight + 1)
+   * @param zero_fill If false, the words are left uninitialized and every
+   * word must be written through row_words() before it is read (lets parallel
+   * workers first-touch their own slice)
+   */
+  DecisionBitset(std::size_t rows, std::size_t cols, bool zero_fill = true);
+
+  /**
+   * @brief Construct a new DecisionBitset object backed by a memory-mapped
+   * scratch file (the words start zeroed).
+   * @param rows Number of rows (one per item)
+   * @param cols Number of cells per row (max_weight + 1)
+   * @param scratch_directory Directory for the scratch file (empty: the
+   * system temporary directory)
+   * @throws std::runtime_error if the file cannot be created, allocated or
+   * mapped (e.g. not enough disk space: the blocks are reserved up front),
+   * or on platforms without mmap
+   */
+  DecisionBitset(std::size_t rows, std::size_t cols,
+                 const std::string &scratch_directory);
+
+  DecisionBitset(const DecisionBitset &) = delete;
+  DecisionBitset &operator=(const DecisionBitset &) = delete;
+
+  /**
+   * @brief Destroy the DecisionBitset object, releasing the heap words or
+   * unmapping the scratch file.
+   */
+  ~DecisionBitset();
+
+  /**
+   * @brief Sets the bit for cell (row, w).
+   * @param row Row index
+   * @param w Capacity index
+   */
+  void set(std::size_t row, std::size_t w) {
+    words[row * words_per_row + (w >> 6)] |= std::uint64_t(1) << (w & 63);
+  }
+
+  /**
+   * @brief Get the words of one row, to be filled word by word.
+   * @param row Row index
+   * @return Pointer to the first of the row's words
+   */
+  std::uint64_t *row_words(std::size_t row) {
+    return words + row * words_per_row;
+  }
+
+  /**
+   * @brief Tests the bit for cell (row, w).
+   * @param row Row index
+   * @param w Capacity index
+   * @return True if the bit is set
+   */
+  bool test(std::size_t row, std::size_t w) const {
+    return (words[row * words_per_row + (w >> 6)] >> (w & 63)) & 1;
+  }
+
+  /**
+   * @brief Tests the bit for cell (row, w) without mapping the row back into
+   * memory: a mapped bitset reads the word from the scratch file. Meant for
+   * reconstruction, after rows_completed(get_rows()).
+   * @param row Row index
+   * @param w Capacity index
+   * @return True if the bit is set
+   * @throws std::runtime_error if the scratch file cannot be read
+   */
+  bool read(std::size_t row, std::size_t w) const;
+
+  /**
+   * @brief Signals that rows [0, end_row) will not be written again. For a
+   * mapped bitset, every full chunk of finished rows is written to disk and
+   * released from memory; on the heap this does nothing.
+   * @param end_row Number of finished rows
+   */
+  void rows_completed(std::size_t end_row);
+
+  /**
+   * @brief Whether the bits live in a memory-mapped scratch file.
+   * @return True if out-of-core
+   */
+  bool is_mapped() const { return mapped_bytes != 0; }
+
+  /**
+   * @brief Get the number of rows.
+   * @return Number of rows
+   */
+  std::size_t get_rows() const { return rows; }
+
+  /**
+   * @brief Get the memory used by the packed bits in bytes.
+   * @return Memory usage in bytes
+   * @note For a mapped bitset this is the size of the scratch file; at most
+   * about one writeback chunk of it is kept in memory while rows are written.
+   */
+  std::size_t get_memory_usage() const {
+    return rows * words_per_row * sizeof(std::uint64_t);
+  }
+
+  /**
+   * @brief Get the number of bytes kept in memory while rows are written.
+   * @return Heap bytes, or the writeback chunk for a mapped bitset
+   */
+  std::size_t get_resident_limit() const {
+    return is_mapped() ? WRITEBACK_CHUNK : get_memory_usage();
+  }
+};
+
+#endif // DECISION_BITSET_H
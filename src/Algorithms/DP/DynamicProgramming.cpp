@@ -1,5 +1,22 @@
 #include "DynamicProgramming.h"
 
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <deque>
+#include <new>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+#include "../REDUCTION/InstanceReduction.h"
+#include "SpinBarrier.h"
+#include "WeightReduction.h"
+
+// States the memoized DP tables are sized for up front. Sparse instances
+// memoize far fewer than n * W states, so the table starts small and doubles
+static constexpr std::size_t MEMO_INITIAL_STATES = std::size_t(1) << 10;
+
 std::unique_ptr<DPTable>
 DynamicProgramming::create_table(TableType type, unsigned int n,
                                  unsigned int max_weight) {
@@ -16,118 +33,141 @@ DynamicProgramming::create_table(TableType type, unsigned int n,
 
   if (type == TableType::Vector)
     return std::make_unique<VectorDPTable>(n, max_weight, entry_factory);
-  else
-    return std::make_unique<HashMapDPTable>(entry_factory);
-}
-
-// Helper: create a new DPEntryBase for the include case
-static std::unique_ptr<DPEntryBase>
-make_include_entry(const DPEntryBase &base, const Pallet &p,
-                   bool draw_condition, bool lexicographical_order) {
-  if (!draw_condition) {
-    return std::make_unique<DPSimpleEntry>(base.get_profit() + p.get_profit());
-  } else if (!lexicographical_order) {
-    return std::make_unique<DPEntryDraw>(base.get_profit() + p.get_profit(),
-                                         base.get_weight() + p.get_weight(),
-                                         base.get_count() + 1);
-  } else {
-    std::vector<std::string> ids = base.get_ids();
-    ids.push_back(p.get_id());
-    return std::make_unique<DPEntryLex>(base.get_profit() + p.get_profit(),
-                                        base.get_weight() + p.get_weight(),
-                                        base.get_count() + 1, ids);
+  if (type == TableType::Flat) {
+    if (!draw_condition)
+      return std::make_unique<FlatDPTable<DPSimpleEntry>>(n, max_weight);
+    else if (!lexicographical_order)
+      return std::make_unique<FlatDPTable<DPEntryDraw>>(n, max_weight);
+    else
+      return std::make_unique<FlatDPTable<DPEntryLex>>(n, max_weight);
+  }
+  if (type == TableType::HashMap || type == TableType::IterativeHashMap) {
+    std::size_t states = static_cast<std::size_t>(n) * max_weight + n;
+    std::size_t expected = std::min(states, MEMO_INITIAL_STATES);
+    if (!draw_condition)
+      return std::make_unique<OpenAddressingDPTable<DPSimpleEntry>>(expected);
+    else if (!lexicographical_order)
+      return std::make_unique<OpenAddressingDPTable<DPEntryDraw>>(expected);
+    else
+      return std::make_unique<OpenAddressingDPTable<DPEntryLex>>(expected);
   }
+  throw std::invalid_argument("TableType has no DPTable representation");
 }
 
-// --- Polymorphic Top-Down DP (no reconstruction) ---
-std::unique_ptr<DPEntryBase> DynamicProgramming::dp_solve_top_down(
-    const std::vector<Pallet> &pallets, std::unique_ptr<DPTable> &dp,
-    unsigned int i, unsigned int w,
-    std::chrono::steady_clock::time_point deadline, bool &timed_out) {
-  if (std::chrono::steady_clock::now() > deadline) {
-    timed_out = true;
-    return DPEntryBase::make_not_computed(draw_condition,
-                                          lexicographical_order);
+// Helper: human-readable table name used in result messages
+static std::string table_type_name(TableType type) {
+  switch (type) {
+  case TableType::Vector:
+    return "Vector";
+  case TableType::Flat:
+    return "Flat";
+  case TableType::Bitset:
+    return "Bitset";
+  case TableType::Parallel:
+    return "Parallel Bitset";
+  case TableType::ProfitIndexed:
+    return "Profit-Indexed";
+  case TableType::IterativeHashMap:
+    return "Iterative HashMap";
+  case TableType::OutOfCore:
+    return "Out-of-Core Bitset";
+  case TableType::Tiled:
+    return "Tiled Bitset";
+  case TableType::SubsetSum:
+    return "Subset-Sum Bitset";
+  case TableType::WeightClass:
+    return "Weight-Class";
+  case TableType::Auto:
+    return "Auto";
+  default:
+    return "HashMap";
   }
+}
+
+// Helper: human-readable memory size used in result messages
+static std::string format_memory(std::size_t memory) {
+  if (memory < 1024)
+    return std::to_string(memory) + " B";
+  else if (memory < 1024 * 1024)
+    return std::to_string(memory / 1024) + " KB";
+  else
+    return std::to_string(memory / (1024 * 1024)) + " MB";
+}
+
+// --- Templated Top-Down DP (no reconstruction) ---
+template <class Policy, class Table>
+typename Policy::Entry DynamicProgramming::dp_solve_top_down(
+    const std::vector<Pallet> &pallets, Table &dp, unsigned int i,
+    unsigned int w, SolveBudget &budget) {
+  using Entry = typename Policy::Entry;
+  if (budget.tick())
+    return Policy::not_computed();
   if (i == 0 || w == 0)
-    return DPEntryBase::make_empty(draw_condition, lexicographical_order);
+    return Policy::empty();
 
-  const DPEntryBase &cached = dp->get(i, w);
+  const Entry &cached = dp.at(i, w);
   // NOT_COMPUTED sentinel: profit == UINT_MAX
-  if (cached.get_profit() != UINT_MAX)
-    return cached.clone();
+  if (Policy::is_computed(cached))
+    return cached;
 
   const Pallet &p = pallets[i - 1];
-  std::unique_ptr<DPEntryBase> exclude =
-      dp_solve_top_down(pallets, dp, i - 1, w, deadline, timed_out);
-  std::unique_ptr<DPEntryBase> include;
-  if (p.get_weight() <= w) {
-    auto base = dp_solve_top_down(pallets, dp, i - 1, w - p.get_weight(),
-                                  deadline, timed_out);
-    include =
-        make_include_entry(*base, p, draw_condition, lexicographical_order);
-  } else {
-    include = DPEntryBase::make_empty(draw_condition, lexicographical_order);
-  }
-  std::unique_ptr<DPEntryBase> result;
-  if (*exclude < *include)
-    result = std::move(include);
-  else
-    result = std::move(exclude);
-  dp->set(i, w, result->clone());
+  Entry exclude = dp_solve_top_down<Policy>(pallets, dp, i - 1, w, budget);
+  Entry include = Policy::empty();
+  if (p.get_weight() <= w)
+    include = Policy::include(
+        dp_solve_top_down<Policy>(pallets, dp, i - 1, w - p.get_weight(),
+                                  budget),
+        p);
+  const Entry &result = Policy::less(exclude, include) ? include : exclude;
+  dp.put(i, w, result);
   return result;
 }
 
-// --- Polymorphic Top-Down DP (with reconstruction) ---
-std::unique_ptr<DPEntryBase> DynamicProgramming::dp_solve_top_down(
-    const std::vector<Pallet> &pallets, std::unique_ptr<DPTable> &dp,
-    unsigned int i, unsigned int w, std::vector<Pallet> &used_pallets,
-    std::chrono::steady_clock::time_point deadline, bool &timed_out) {
-  auto result = dp_solve_top_down(pallets, dp, i, w, deadline, timed_out);
-  if (timed_out)
-    return DPEntryBase::make_not_computed(draw_condition,
-                                          lexicographical_order);
+// --- Templated get-or-compute used for safe backtracking ---
+template <class Policy, class Table>
+const typename Policy::Entry &
+DynamicProgramming::dp_get_or_compute(const std::vector<Pallet> &pallets,
+                                      Table &dp, unsigned int i,
+                                      unsigned int w) {
+  using Entry = typename Policy::Entry;
+  const Entry &entry = dp.at(i, w);
+  if (Policy::is_computed(entry))
+    return entry;
+  if (i == 0 || w == 0) {
+    dp.put(i, w, Policy::empty());
+    return dp.at(i, w);
+  }
+  const Pallet &p = pallets[i - 1];
+  Entry exclude = dp_get_or_compute<Policy>(pallets, dp, i - 1, w);
+  Entry include = Policy::empty();
+  if (p.get_weight() <= w)
+    include = Policy::include(
+        dp_get_or_compute<Policy>(pallets, dp, i - 1, w - p.get_weight()), p);
+  dp.put(i, w, Policy::less(exclude, include) ? include : exclude);
+  return dp.at(i, w);
+}
+
+// --- Templated Top-Down DP (with reconstruction) ---
+template <class Policy, class Table>
+typename Policy::Entry DynamicProgramming::dp_solve_top_down(
+    const std::vector<Pallet> &pallets, Table &dp, unsigned int i,
+    unsigned int w, std::vector<Pallet> &used_pallets,
+    SolveBudget &budget) {
+  using Entry = typename Policy::Entry;
+  Entry result =
+      dp_solve_top_down<Policy>(pallets, dp, i, w, budget);
+  if (budget.is_exhausted())
+    return Policy::not_computed();
   used_pallets.clear();
-  // get_or_compute lambda for safe backtracking
-  std::function<const DPEntryBase &(unsigned int, unsigned int)>
-      get_or_compute =
-          [&](unsigned int i, unsigned int w) -> const DPEntryBase & {
-    const DPEntryBase &entry = dp->get(i, w);
-    if (entry.get_profit() != UINT_MAX)
-      return entry;
-    if (i == 0 || w == 0) {
-      auto empty =
-          DPEntryBase::make_empty(draw_condition, lexicographical_order);
-      dp->set(i, w, empty->clone());
-      return dp->get(i, w);
-    }
-    const Pallet &p = pallets[i - 1];
-    std::unique_ptr<DPEntryBase> exclude = get_or_compute(i - 1, w).clone();
-    std::unique_ptr<DPEntryBase> include;
-    if (p.get_weight() <= w) {
-      auto base = get_or_compute(i - 1, w - p.get_weight()).clone();
-      include =
-          make_include_entry(*base, p, draw_condition, lexicographical_order);
-    } else {
-      include = DPEntryBase::make_empty(draw_condition, lexicographical_order);
-    }
-    std::unique_ptr<DPEntryBase> result;
-    if (*exclude < *include)
-      result = std::move(include);
-    else
-      result = std::move(exclude);
-    dp->set(i, w, result->clone());
-    return dp->get(i, w);
-  };
   // Backtrack to reconstruct solution
   while (i > 0 && w > 0) {
-    const DPEntryBase &curr = get_or_compute(i, w);
+    // Copied: computing a missing state may move the table's entries
+    const Entry curr = dp_get_or_compute<Policy>(pallets, dp, i, w);
     const Pallet &p = pallets[i - 1];
     if (p.get_weight() <= w) {
-      const DPEntryBase &incl = get_or_compute(i - 1, w - p.get_weight());
-      std::unique_ptr<DPEntryBase> incl_plus =
-          make_include_entry(incl, p, draw_condition, lexicographical_order);
-      if (curr.equals(*incl_plus)) {
+      const Entry &incl =
+          dp_get_or_compute<Policy>(pallets, dp, i - 1, w - p.get_weight());
+      if (Policy::equal(curr, Policy::include(incl, p))) {
         used_pallets.push_back(p);
         w -= p.get_weight();
         i--;
@@ -140,47 +180,110 @@ std::unique_ptr<DPEntryBase> DynamicProgramming::dp_solve_top_down(
   return result;
 }
 
-// --- Polymorphic Bottom-Up DP (with reconstruction) ---
-std::unique_ptr<DPEntryBase> DynamicProgramming::dp_solve_bottom_up(
-    const std::vector<Pallet> &pallets, std::unique_ptr<DPTable> &dp,
-    unsigned int n, unsigned int max_weight, std::vector<Pallet> &used_pallets,
-    std::chrono::steady_clock::time_point deadline, bool &timed_out) {
+// --- Templated Top-Down DP on an explicit work stack (with reconstruction)
+template <class Policy, class Table>
+typename Policy::Entry DynamicProgramming::dp_solve_top_down_iterative(
+    const std::vector<Pallet> &pallets, Table &dp, unsigned int n,
+    unsigned int max_weight, std::vector<Pallet> &used_pallets,
+    SolveBudget &budget) {
+  using Entry = typename Policy::Entry;
+  const Entry empty = Policy::empty();
+  // Base states (no pallet or no capacity) are never stored
+  auto lookup = [&](unsigned int i, unsigned int w) -> const Entry * {
+    return (i == 0 || w == 0) ? &empty : dp.find(i, w);
+  };
+
+  struct Frame {
+    unsigned int i;
+    unsigned int w;
+    bool expanded; ///< Children already pushed
+  };
+  std::vector<Frame> stack;
+  stack.reserve(2 * static_cast<std::size_t>(n) + 1);
+  if (lookup(n, max_weight) == nullptr)
+    stack.push_back({n, max_weight, false});
+
+  while (!stack.empty()) {
+    Frame &frame = stack.back();
+    unsigned int i = frame.i, w = frame.w;
+    const Pallet &p = pallets[i - 1];
+    bool fits = p.get_weight() <= w;
+    // Pushed by two parents: the first one already resolved it
+    if (!frame.expanded && dp.find(i, w) != nullptr) {
+      stack.pop_back();
+      continue;
+    }
+    const Entry *exclude = lookup(i - 1, w);
+    const Entry *base = fits ? lookup(i - 1, w - p.get_weight()) : &empty;
+    if (exclude == nullptr || base == nullptr) {
+      // Resolved once both children are memoized (they are never pushed
+      // again: a frame is expanded at most once)
+      frame.expanded = true; // Before push_back, which may move the frame
+      if (base == nullptr)
+        stack.push_back({i - 1, w - p.get_weight(), false});
+      if (exclude == nullptr)
+        stack.push_back({i - 1, w, false});
+      continue;
+    }
+    stack.pop_back();
+    if (budget.tick())
+      return Policy::not_computed();
+    Entry include = fits ? Policy::include(*base, p) : empty;
+    if (Policy::less(*exclude, include))
+      dp.put(i, w, std::move(include));
+    else
+      dp.put(i, w, *exclude);
+  }
+
+  used_pallets.clear();
+  unsigned int i = n, w = max_weight;
+  while (i > 0 && w > 0) {
+    const Entry &curr = *lookup(i, w);
+    const Pallet &p = pallets[i - 1];
+    if (p.get_weight() <= w &&
+        Policy::equal(curr,
+                      Policy::include(*lookup(i - 1, w - p.get_weight()), p))) {
+      used_pallets.push_back(p);
+      w -= p.get_weight();
+    }
+    i--;
+  }
+  std::reverse(used_pallets.begin(), used_pallets.end());
+  return *lookup(n, max_weight);
+}
+
+// --- Templated Bottom-Up DP (with reconstruction) ---
+template <class Policy, class Table>
+typename Policy::Entry DynamicProgramming::dp_solve_bottom_up(
+    const std::vector<Pallet> &pallets, Table &dp, unsigned int n,
+    unsigned int max_weight, std::vector<Pallet> &used_pallets,
+    SolveBudget &budget) {
+  using Entry = typename Policy::Entry;
+  const Entry empty = Policy::empty();
   for (unsigned int i = 1; i <= n; i++) {
+    // One tick per cell, charged a row at a time
+    if (budget.tick(static_cast<unsigned long long>(max_weight) + 1))
+      return Policy::not_computed();
+    const Pallet &p = pallets[i - 1];
     for (unsigned int w = 0; w <= max_weight; w++) {
-      if (std::chrono::steady_clock::now() > deadline) {
-        timed_out = true;
-        return DPEntryBase::make_not_computed(draw_condition,
-                                              lexicographical_order);
-      }
-      const Pallet &p = pallets[i - 1];
-      const DPEntryBase &exclude = dp->get(i - 1, w);
-      std::unique_ptr<DPEntryBase> include;
+      const Entry &exclude = dp.at(i - 1, w);
       if (p.get_weight() <= w) {
-        const DPEntryBase &base = dp->get(i - 1, w - p.get_weight());
-        include =
-            make_include_entry(base, p, draw_condition, lexicographical_order);
+        Entry include =
+            Policy::include(dp.at(i - 1, w - p.get_weight()), p);
+        dp.put(i, w, Policy::less(exclude, include) ? include : exclude);
       } else {
-        include =
-            DPEntryBase::make_empty(draw_condition, lexicographical_order);
+        dp.put(i, w, Policy::less(exclude, empty) ? empty : exclude);
       }
-      std::unique_ptr<DPEntryBase> best;
-      if (exclude < *include)
-        best = std::move(include);
-      else
-        best = exclude.clone();
-      dp->set(i, w, best->clone());
     }
   }
   used_pallets.clear();
   unsigned int i = n, w = max_weight;
   while (i > 0 && w > 0) {
-    const DPEntryBase &curr = dp->get(i, w);
+    const Entry &curr = dp.at(i, w);
     const Pallet &p = pallets[i - 1];
     if (p.get_weight() <= w) {
-      const DPEntryBase &incl = dp->get(i - 1, w - p.get_weight());
-      std::unique_ptr<DPEntryBase> incl_plus =
-          make_include_entry(incl, p, draw_condition, lexicographical_order);
-      if (curr.equals(*incl_plus)) {
+      const Entry &incl = dp.at(i - 1, w - p.get_weight());
+      if (Policy::equal(curr, Policy::include(incl, p))) {
         used_pallets.push_back(p);
         w -= p.get_weight();
         i--;
@@ -190,76 +293,1067 @@ std::unique_ptr<DPEntryBase> DynamicProgramming::dp_solve_bottom_up(
     i--;
   }
   std::reverse(used_pallets.begin(), used_pallets.end());
-  return dp->get(n, max_weight).clone();
+  return dp.at(n, max_weight);
+}
+
+// Helper: walks the "taken" bits back from (n, max_weight)
+static void bitset_backtrack(const std::vector<Pallet> &pallets,
+                             const DecisionBitset &taken,
+                             unsigned int max_weight,
+                             std::vector<Pallet> &used_pallets) {
+  used_pallets.clear();
+  unsigned int i = pallets.size(), w = max_weight;
+  while (i > 0 && w > 0) {
+    if (taken.read(i - 1, w)) {
+      used_pallets.push_back(pallets[i - 1]);
+      w -= pallets[i - 1].get_weight();
+    }
+    i--;
+  }
+  std::reverse(used_pallets.begin(), used_pallets.end());
+}
+
+// --- Rolling rows + bit-packed decisions (with reconstruction) ---
+template <class Kernel>
+unsigned int DynamicProgramming::dp_solve_bitset(
+    const Kernel &kernel, const std::vector<Pallet> &pallets,
+    unsigned int max_weight, std::vector<Pallet> &used_pallets,
+    SolveBudget &budget, DPRunStats &stats, bool out_of_core) {
+  using Entry = typename Kernel::Entry;
+  unsigned int n = pallets.size();
+  std::size_t cols = static_cast<std::size_t>(max_weight) + 1;
+  std::size_t num_words = (cols + 63) / 64;
+  const Entry empty = kernel.empty();
+  std::vector<Entry> prev(cols, empty);
+  std::vector<Entry> curr(cols, empty);
+  auto taken = out_of_core
+                   ? std::make_unique<DecisionBitset>(n, cols,
+                                                      scratch_directory)
+                   : std::make_unique<DecisionBitset>(n, cols, false);
+  stats.num_entries = 2 * cols + n * cols;
+  stats.memory = 2 * cols * sizeof(Entry) +
+                 std::min(taken->get_resident_limit(),
+                          taken->get_memory_usage());
+  if (out_of_core)
+    stats.details = " | Decisions on disk: " +
+                    format_memory(taken->get_memory_usage());
+
+  for (unsigned int i = 1; i <= n; i++) {
+    if (budget.tick(cols))
+      return 0;
+    kernel.update(prev.data(), curr.data(), pallets[i - 1], cols, 0,
+                  num_words, taken->row_words(i - 1));
+    std::swap(prev, curr);
+    taken->rows_completed(i);
+  }
+
+  // Out-of-core: one word per row is read back from the scratch file
+  bitset_backtrack(pallets, *taken, max_weight, used_pallets);
+  return kernel.profit(prev[max_weight]);
+}
+
+// --- Row-parallel rolling rows + bit-packed decisions ---
+template <class Kernel>
+unsigned int DynamicProgramming::dp_solve_parallel(
+    const Kernel &kernel, const std::vector<Pallet> &pallets,
+    unsigned int max_weight, std::vector<Pallet> &used_pallets,
+    SolveBudget &budget, DPRunStats &stats) {
+  using Entry = typename Kernel::Entry;
+  unsigned int n = pallets.size();
+  std::size_t cols = static_cast<std::size_t>(max_weight) + 1;
+  std::size_t num_words = (cols + 63) / 64;
+  unsigned int threads = num_threads ? num_threads
+                                     : std::max(1u, std::thread::hardware_concurrency());
+  threads = static_cast<unsigned int>(
+      std::min<std::size_t>(threads, num_words));
+  const Entry empty = kernel.empty();
+
+  // Rows and bits are left untouched here: each worker constructs (first
+  // touches) its own slice, so on NUMA hosts the pages land on its node
+  Entry *rows[2] = {static_cast<Entry *>(::operator new(cols * sizeof(Entry))),
+                    static_cast<Entry *>(::operator new(cols * sizeof(Entry)))};
+  DecisionBitset taken(n, cols, false);
+  stats.num_entries = 2 * cols + n * cols;
+  stats.memory = 2 * cols * sizeof(Entry) + taken.get_memory_usage();
+
+  SpinBarrier barrier(threads);
+  std::atomic<bool> stop{false};
+  std::vector<std::chrono::steady_clock::duration> busy(threads);
+
+  // Slices are whole 64-cell words, so no two workers share a bitset word
+  auto worker = [&](unsigned int t) {
+    std::size_t k_lo = num_words * t / threads;
+    std::size_t k_hi = num_words * (t + 1) / threads;
+    std::size_t c_lo = k_lo * 64, c_hi = std::min(k_hi * 64, cols);
+    for (std::size_t w = c_lo; w < c_hi; w++) {
+      new (rows[0] + w) Entry(empty);
+      new (rows[1] + w) Entry(empty);
+    }
+    barrier.arrive_and_wait();
+    Entry *prev = rows[0], *curr = rows[1];
+    for (unsigned int i = 1; i <= n; i++) {
+      auto row_start = std::chrono::steady_clock::now();
+      kernel.update(prev, curr, pallets[i - 1], cols, k_lo, k_hi,
+                    taken.row_words(i - 1));
+      auto row_end = std::chrono::steady_clock::now();
+      busy[t] += row_end - row_start;
+      // The budget is charged once per row, by worker 0 only
+      if (t == 0 && budget.tick(cols))
+        stop.store(true, std::memory_order_relaxed);
+      barrier.arrive_and_wait();
+      if (stop.load(std::memory_order_relaxed))
+        break;
+      std::swap(prev, curr);
+    }
+  };
+
+  auto kernel_start = std::chrono::steady_clock::now();
+  std::vector<std::thread> pool;
+  pool.reserve(threads - 1);
+  for (unsigned int t = 1; t < threads; t++)
+    pool.emplace_back(worker, t);
+  worker(0);
+  for (auto &thread : pool)
+    thread.join();
+  auto wall = std::chrono::steady_clock::now() - kernel_start;
+
+  unsigned int result =
+      stop.load() ? 0 : kernel.profit(rows[n % 2][max_weight]);
+  for (std::size_t w = 0; w < cols; w++) {
+    rows[0][w].~Entry();
+    rows[1][w].~Entry();
+  }
+  ::operator delete(rows[0]);
+  ::operator delete(rows[1]);
+
+  // Efficiency: share of the threads' wall time spent computing cells (the
+  // rest is barrier waiting and load imbalance)
+  std::chrono::steady_clock::duration total_busy{};
+  for (auto b : busy)
+    total_busy += b;
+  double efficiency =
+      wall.count() > 0
+          ? 100.0 * total_busy.count() / (static_cast<double>(wall.count()) *
+                                          threads)
+          : 100.0;
+  stats.details = " | Threads: " + std::to_string(threads) +
+                  " | Parallel efficiency: " +
+                  std::to_string(static_cast<int>(efficiency + 0.5)) + "%";
+
+  if (stop.load())
+    return result;
+  bitset_backtrack(pallets, taken, max_weight, used_pallets);
+  return result;
+}
+
+// Tiled blocks: pallets per block and bytes of one tile's block rows
+static constexpr unsigned int DEFAULT_TILE_ITEMS = 8;
+static constexpr std::size_t TILE_BYTES = 256 * 1024;
+
+// --- Cache-blocked rolling rows + bit-packed decisions ---
+template <class Kernel>
+unsigned int DynamicProgramming::dp_solve_tiled(
+    const Kernel &kernel, const std::vector<Pallet> &pallets,
+    unsigned int max_weight, std::vector<Pallet> &used_pallets,
+    SolveBudget &budget, DPRunStats &stats) {
+  using Entry = typename Kernel::Entry;
+  unsigned int n = pallets.size();
+  std::size_t cols = static_cast<std::size_t>(max_weight) + 1;
+  std::size_t num_words = (cols + 63) / 64;
+  unsigned int k = tile_items ? tile_items : DEFAULT_TILE_ITEMS;
+  k = std::max(1u, std::min(k, n));
+  std::size_t tile_words =
+      tile_width ? (static_cast<std::size_t>(tile_width) + 63) / 64
+                 : std::max<std::size_t>(
+                       1, TILE_BYTES / ((k + 1) * 64 * sizeof(Entry)));
+  tile_words = std::min(tile_words, num_words);
+  std::size_t tile_cells = std::min(tile_words * 64, cols);
+
+  // rows[0] holds the row before the block, rows[j] the row after its j-th
+  // pallet
+  const Entry empty = kernel.empty();
+  std::vector<std::vector<Entry>> rows(k + 1,
+                                       std::vector<Entry>(cols, empty));
+  DecisionBitset taken(n, cols, false);
+  stats.num_entries = (k + 1) * cols + n * cols;
+  stats.memory = (k + 1) * cols * sizeof(Entry) + taken.get_memory_usage();
+
+  for (unsigned int i0 = 0; i0 < n; i0 += k) {
+    unsigned int block = std::min(k, n - i0);
+    if (budget.tick(block * cols))
+      return 0;
+    for (std::size_t t = 0; t < num_words; t += tile_words) {
+      std::size_t t_end = std::min(t + tile_words, num_words);
+      for (unsigned int j = 0; j < block; j++)
+        kernel.update(rows[j].data(), rows[j + 1].data(), pallets[i0 + j],
+                      cols, t, t_end, taken.row_words(i0 + j));
+    }
+    std::swap(rows[0], rows[block]);
+  }
+
+  // Row traffic, in entries: a rolling row pass reads two rows and writes
+  // one per pallet. A block reads its first row and writes its last once;
+  // the rows in between stay in cache, except the reads of pallets heavier
+  // than a tile, which reach back into tiles already evicted
+  std::size_t rolling = 3 * static_cast<std::size_t>(n) * cols;
+  std::size_t tiled = 2 * static_cast<std::size_t>((n + k - 1) / k) * cols;
+  for (const Pallet &p : pallets)
+    if (p.get_weight() >= tile_cells)
+      tiled += cols;
+  stats.details = " | Tiles: " + std::to_string(k) + " pallets x " +
+                  std::to_string(tile_cells) +
+                  " cells | Estimated row traffic: " +
+                  format_memory(tiled * sizeof(Entry)) + " (rolling rows: " +
+                  format_memory(rolling * sizeof(Entry)) + ")";
+
+  bitset_backtrack(pallets, taken, max_weight, used_pallets);
+  return kernel.profit(rows[0][max_weight]);
+}
+
+// Dense types switch to profit indexing when (P + 1) * ratio <= (W + 1)
+static constexpr std::size_t PROFIT_INDEX_RATIO = 8;
+
+// Helper: sum of all profits (last index of the profit axis)
+static std::size_t profit_sum(const std::vector<Pallet> &pallets) {
+  std::size_t sum = 0;
+  for (const Pallet &p : pallets)
+    sum += p.get_profit();
+  return sum;
+}
+
+bool DynamicProgramming::prefers_profit_indexing(
+    const std::vector<Pallet> &pallets, unsigned int max_weight) {
+  return (profit_sum(pallets) + 1) * PROFIT_INDEX_RATIO <=
+         static_cast<std::size_t>(max_weight) + 1;
+}
+
+namespace {
+// Lightest way found so far to reach one exact total profit
+struct MinWeightState {
+  unsigned int weight; ///< UINT_MAX if the profit is unreachable
+  unsigned int count;
+};
+} // namespace
+
+// --- Profit-indexed DP: minimum weight per exact profit (with reconstruction)
+unsigned int DynamicProgramming::dp_solve_profit_indexed(
+    const std::vector<Pallet> &pallets, unsigned int max_weight,
+    std::vector<Pallet> &used_pallets,
+    SolveBudget &budget,
+    DPRunStats &stats) {
+  unsigned int n = pallets.size();
+  std::size_t cols = profit_sum(pallets) + 1;
+  std::vector<MinWeightState> row(cols, MinWeightState{UINT_MAX, 0});
+  row[0] = MinWeightState{0, 0};
+  DecisionBitset taken(n, cols);
+  stats.num_entries = cols + n * cols;
+  stats.memory = cols * sizeof(MinWeightState) + taken.get_memory_usage();
+
+  // Profits above `reach` are still unreachable, so rows only scan [0, reach]
+  std::size_t reach = 0;
+  for (unsigned int i = 0; i < n; i++) {
+    if (budget.tick(reach + 1))
+      return 0;
+    const Pallet &p = pallets[i];
+    if (static_cast<unsigned int>(p.get_weight()) > max_weight)
+      continue;
+    std::size_t pp = p.get_profit();
+    // In place, from high to low profits, so reads still see row i - 1.
+    // Ties go to the include side, like the table-based backtracking.
+    for (std::size_t q = reach + pp + 1; q-- > pp;) {
+      const MinWeightState &base = row[q - pp];
+      if (base.weight == UINT_MAX)
+        continue;
+      unsigned long long weight =
+          static_cast<unsigned long long>(base.weight) + p.get_weight();
+      if (weight > max_weight)
+        continue;
+      MinWeightState &curr = row[q];
+      unsigned int count = base.count + 1;
+      bool better = weight < curr.weight ||
+                    (weight == curr.weight &&
+                     (!draw_condition || count <= curr.count));
+      if (better) {
+        curr = MinWeightState{static_cast<unsigned int>(weight), count};
+        taken.set(i, q);
+      }
+    }
+    reach += pp;
+  }
+
+  std::size_t best = reach;
+  while (row[best].weight == UINT_MAX)
+    best--;
+  used_pallets.clear();
+  std::size_t q = best;
+  for (unsigned int i = n; i > 0 && q > 0; i--) {
+    if (taken.test(i - 1, q)) {
+      used_pallets.push_back(pallets[i - 1]);
+      q -= pallets[i - 1].get_profit();
+    }
+  }
+  std::reverse(used_pallets.begin(), used_pallets.end());
+  return static_cast<unsigned int>(best);
+}
+
+bool DynamicProgramming::profit_ratio(const std::vector<Pallet> &pallets,
+                                      unsigned long long &numerator,
+                                      unsigned long long &denominator) {
+  auto first = std::find_if(pallets.begin(), pallets.end(),
+                            [](const Pallet &p) { return p.get_weight() > 0; });
+  if (first == pallets.end())
+    return false;
+  unsigned long long p0 = first->get_profit(), w0 = first->get_weight();
+  // Cross-multiplied, so fractional ratios are exact (both sides < 2^64)
+  for (const Pallet &p : pallets)
+    if (static_cast<unsigned long long>(p.get_profit()) * w0 !=
+        p0 * static_cast<unsigned int>(p.get_weight()))
+      return false;
+  unsigned long long g = std::gcd(p0, w0);
+  numerator = p0 / g;
+  denominator = w0 / g;
+  return true;
+}
+
+// --- Subset sum: reachable loads as bits, first item per load (with
+// reconstruction) ---
+unsigned int DynamicProgramming::dp_solve_subset_sum(
+    const std::vector<Pallet> &pallets, unsigned int max_weight,
+    std::vector<Pallet> &used_pallets, SolveBudget &budget,
+    DPRunStats &stats) {
+  unsigned int n = pallets.size();
+  std::size_t cols = static_cast<std::size_t>(max_weight) + 1;
+  std::size_t num_words = (cols + 63) / 64;
+  std::vector<std::uint64_t> reach(num_words, 0);
+  std::vector<unsigned int> first_item(cols, 0);
+  reach[0] = 1;
+  stats.num_entries = cols;
+  stats.memory = num_words * sizeof(std::uint64_t) +
+                 cols * sizeof(unsigned int);
+  DPKernels::ISA isa = DPKernels::detect_isa();
+
+  for (unsigned int i = 0; i < n; i++) {
+    if (budget.tick(num_words))
+      return 0;
+    DPKernels::add_item_reach(reach.data(), cols, pallets[i].get_weight(), i,
+                              first_item.data(), isa);
+  }
+
+  // Heaviest reachable load, then back through the first item reaching each
+  // load: load - weight was reachable before that item, so the items strictly
+  // decrease and none is taken twice
+  std::size_t k = num_words;
+  while (k > 1 && reach[k - 1] == 0)
+    k--;
+  std::size_t best = (k - 1) * 64 + 63 - __builtin_clzll(reach[k - 1]);
+  used_pallets.clear();
+  unsigned int profit = 0;
+  for (std::size_t w = best; w > 0;) {
+    const Pallet &p = pallets[first_item[w]];
+    used_pallets.push_back(p);
+    profit += p.get_profit();
+    w -= p.get_weight();
+  }
+  std::reverse(used_pallets.begin(), used_pallets.end());
+  stats.details = " | ISA: " + DPKernels::isa_name(isa) +
+                  " | Heaviest load: " + std::to_string(best);
+  return profit;
+}
+
+namespace {
+// One residue class r (mod w) of a weight class merge: cell j is capacity
+// r + j * w, `gain[t]` is the key of the t most profitable pallets (concave)
+struct ResidueMerge {
+  const std::int64_t *in;              ///< Row before the class
+  std::int64_t *out;                   ///< Row after the class
+  std::uint32_t *choice;               ///< Pallets of the class taken
+  std::size_t stride;                  ///< w
+  const std::vector<std::int64_t> &gain; ///< gain[t], t = 0..m
+
+  std::int64_t value(std::size_t j, std::size_t i) const {
+    return in[i * stride] + gain[j - i];
+  }
+
+  // out[j] = max over i in [j - m, j] of in[i] + gain[j - i] for j in
+  // [j_lo, j_hi), knowing the best i lies in [i_lo, i_hi]. With a concave
+  // gain the best i never moves left as j grows (the largest one on ties)
+  void concave(std::size_t j_lo, std::size_t j_hi, std::size_t i_lo,
+               std::size_t i_hi) const {
+    if (j_lo >= j_hi)
+      return;
+    std::size_t mid = j_lo + (j_hi - j_lo) / 2;
+    std::size_t m = gain.size() - 1;
+    std::size_t from = std::max(i_lo, mid >= m ? mid - m : 0);
+    std::size_t to = std::min(i_hi, mid);
+    std::size_t best = from;
+    std::int64_t best_value = value(mid, from);
+    for (std::size_t i = from + 1; i <= to; i++) {
+      std::int64_t v = value(mid, i);
+      if (v >= best_value) {
+        best_value = v;
+        best = i;
+      }
+    }
+    out[mid * stride] = best_value;
+    choice[mid * stride] = static_cast<std::uint32_t>(mid - best);
+    concave(j_lo, mid, i_lo, best);
+    concave(mid + 1, j_hi, best, i_hi);
+  }
+
+  // Same merge when every pallet of the class has the same key a (gain[t] =
+  // t * a): sliding-window maximum over the last m + 1 sources
+  void linear(std::size_t len) const {
+    std::size_t m = gain.size() - 1;
+    std::int64_t a = gain[1];
+    std::deque<std::size_t> window;
+    for (std::size_t j = 0; j < len; j++) {
+      if (!window.empty() && window.front() + m < j)
+        window.pop_front();
+      // (j - i) <= m here, so (j - i) * a is at most gain[m]
+      while (!window.empty() &&
+             in[window.back() * stride] +
+                     static_cast<std::int64_t>(j - window.back()) * a <=
+                 in[j * stride])
+        window.pop_back();
+      window.push_back(j);
+      std::size_t i = window.front();
+      out[j * stride] =
+          in[i * stride] + static_cast<std::int64_t>(j - i) * a;
+      choice[j * stride] = static_cast<std::uint32_t>(j - i);
+    }
+  }
+};
+} // namespace
+
+// --- Weight classes: one max-plus merge per distinct weight ---
+unsigned int DynamicProgramming::dp_solve_weight_classes(
+    const std::vector<Pallet> &pallets, unsigned int max_weight,
+    const PackedDrawKey *key, std::vector<Pallet> &used_pallets,
+    SolveBudget &budget, DPRunStats &stats) {
+  std::size_t cols = static_cast<std::size_t>(max_weight) + 1;
+  auto item_key = [&](const Pallet &p) -> std::int64_t {
+    return key ? key->item_key(p) : p.get_profit();
+  };
+
+  // Pallets that fit, grouped by weight, most valuable first
+  std::vector<unsigned int> order;
+  for (unsigned int i = 0; i < pallets.size(); i++)
+    if (pallets[i].get_weight() > 0 &&
+        static_cast<unsigned int>(pallets[i].get_weight()) <= max_weight)
+      order.push_back(i);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](unsigned int a, unsigned int b) {
+                     if (pallets[a].get_weight() != pallets[b].get_weight())
+                       return pallets[a].get_weight() <
+                              pallets[b].get_weight();
+                     return item_key(pallets[a]) > item_key(pallets[b]);
+                   });
+  std::vector<std::size_t> class_start;
+  for (std::size_t k = 0; k < order.size(); k++)
+    if (k == 0 || pallets[order[k]].get_weight() !=
+                      pallets[order[k - 1]].get_weight())
+      class_start.push_back(k);
+  class_start.push_back(order.size());
+  std::size_t classes = class_start.size() - 1;
+
+  std::vector<std::int64_t> prev(cols, 0), curr(cols);
+  std::vector<std::vector<std::uint32_t>> choice(
+      classes, std::vector<std::uint32_t>(cols));
+  stats.num_entries = 2 * cols + classes * cols;
+  stats.memory = 2 * cols * sizeof(std::int64_t) +
+                 classes * cols * sizeof(std::uint32_t);
+  std::size_t linear_classes = 0;
+
+  for (std::size_t c = 0; c < classes; c++) {
+    if (budget.tick(cols))
+      return 0;
+    std::size_t first = class_start[c], m = class_start[c + 1] - first;
+    std::size_t w = pallets[order[first]].get_weight();
+    std::vector<std::int64_t> gain(m + 1, 0);
+    for (std::size_t t = 1; t <= m; t++)
+      gain[t] = gain[t - 1] + item_key(pallets[order[first + t - 1]]);
+    bool linear = item_key(pallets[order[first + m - 1]]) == gain[1];
+    linear_classes += linear;
+    for (std::size_t r = 0; r < w && r < cols; r++) {
+      std::size_t len = (cols - 1 - r) / w + 1;
+      ResidueMerge merge{prev.data() + r, curr.data() + r,
+                         choice[c].data() + r, w, gain};
+      if (linear)
+        merge.linear(len);
+      else
+        merge.concave(0, len, 0, len - 1);
+    }
+    std::swap(prev, curr);
+  }
+
+  // Back through the classes: each one gives its most valuable pallets
+  std::vector<unsigned int> taken;
+  std::size_t w = max_weight;
+  for (std::size_t c = classes; c-- > 0;) {
+    std::size_t first = class_start[c];
+    std::uint32_t t = choice[c][w];
+    for (std::uint32_t k = 0; k < t; k++)
+      taken.push_back(order[first + k]);
+    w -= t * static_cast<std::size_t>(pallets[order[first]].get_weight());
+  }
+  std::sort(taken.begin(), taken.end());
+  used_pallets.clear();
+  for (unsigned int i : taken)
+    used_pallets.push_back(pallets[i]);
+  stats.details = " | Weight classes: " + std::to_string(classes) + " (" +
+                  std::to_string(linear_classes) + " equal-profit) for " +
+                  std::to_string(order.size()) + " pallets";
+  return key ? key->profit(prev[max_weight])
+             : static_cast<unsigned int>(prev[max_weight]);
+}
+
+// --- Lexicographical order from packed draw keys and a canonical pass ---
+unsigned int DynamicProgramming::dp_solve_lex_canonical(
+    const std::vector<Pallet> &pallets, unsigned int max_weight,
+    const PackedDrawKey &key, std::vector<Pallet> &used_pallets,
+    SolveBudget &budget, DPRunStats &stats) {
+  unsigned int n = pallets.size();
+  std::size_t cols = static_cast<std::size_t>(max_weight) + 1;
+  std::size_t num_words = (cols + 63) / 64;
+  std::vector<std::int64_t> prev(cols, 0), curr(cols, 0);
+  // Row i covers pallets [i, n): whether taking / leaving pallet i reaches
+  // the best entry of the cell
+  DecisionBitset include_ok(n, cols, false), exclude_ok(n, cols, false);
+  stats.num_entries = 2 * cols + 2 * static_cast<std::size_t>(n) * cols;
+  stats.memory = 2 * cols * sizeof(std::int64_t) +
+                 include_ok.get_memory_usage() + exclude_ok.get_memory_usage();
+  DPKernels::ISA isa = DPKernels::detect_isa();
+
+  for (unsigned int i = n; i-- > 0;) {
+    if (budget.tick(cols))
+      return 0;
+    const Pallet &p = pallets[i];
+    std::int64_t item = p.get_weight() < cols ? key.item_key(p) : 0;
+    DPKernels::add_item_packed(prev.data(), curr.data(), cols, p.get_weight(),
+                               item, 0, num_words, include_ok.row_words(i),
+                               isa);
+    std::uint64_t *same = exclude_ok.row_words(i);
+    for (std::size_t k = 0; k < num_words; k++) {
+      std::size_t base = k * 64, end = std::min(base + 64, cols);
+      std::uint64_t word = 0;
+      for (std::size_t w = base; w < end; w++)
+        word |= std::uint64_t(curr[w] == prev[w]) << (w - base);
+      same[k] = word;
+    }
+    std::swap(prev, curr);
+  }
+
+  // Every optimal set has the optimum's count. Position by position, take
+  // the smallest id among the pallets the optimum can take next: pallet i
+  // qualifies if it can be taken and every pallet between the last one taken
+  // and i can be left out at the remaining capacity
+  std::int64_t best = prev[max_weight];
+  unsigned int count = key.count(best);
+  used_pallets.clear();
+  std::size_t w = max_weight;
+  unsigned int next = 0;
+  for (unsigned int c = 0; c < count; c++) {
+    unsigned int chosen = n;
+    for (unsigned int i = next; i < n; i++) {
+      if (include_ok.read(i, w) &&
+          (chosen == n || pallets[i].get_id() < pallets[chosen].get_id()))
+        chosen = i;
+      if (!exclude_ok.read(i, w))
+        break;
+    }
+    used_pallets.push_back(pallets[chosen]);
+    w -= pallets[chosen].get_weight();
+    next = chosen + 1;
+  }
+  stats.details = " | Canonical lexicographical pass";
+  return key.profit(best);
+}
+
+// Helper: a * b, saturated at SIZE_MAX (memory estimates of huge instances)
+static std::size_t saturating_mul(std::size_t a, std::size_t b) {
+  return (a != 0 && b > SIZE_MAX / a) ? SIZE_MAX : a * b;
+}
+
+// Helper: a + b, saturated at SIZE_MAX
+static std::size_t saturating_add(std::size_t a, std::size_t b) {
+  return b > SIZE_MAX - a ? SIZE_MAX : a + b;
+}
+
+// Helper: bytes of n rows of packed decision bits over `cols` columns
+static std::size_t decision_bytes(std::size_t n, std::size_t cols) {
+  return saturating_mul(n, (cols + 63) / 64 * sizeof(std::uint64_t));
+}
+
+// --- Memory planner: fastest strategy whose estimate fits the budget ---
+DPPlan DynamicProgramming::plan_table(const std::vector<Pallet> &pallets,
+                                      unsigned int max_weight) const {
+  bool lex = draw_condition && lexicographical_order;
+  std::size_t n = pallets.size();
+  std::size_t cols = static_cast<std::size_t>(max_weight) + 1;
+  bool fits = draw_condition && PackedDrawKey(pallets, max_weight).fits();
+  bool packed = !lex && packed_draw_key && fits;
+  // Canonical lexicographical order: Bitset only, with two bit planes
+  bool canonical = lex && canonical_lex && fits;
+  std::size_t entry = !draw_condition ? sizeof(DPSimpleEntry)
+                      : packed        ? sizeof(std::int64_t)
+                      : !lex          ? sizeof(DPEntryDraw)
+                                      : sizeof(DPEntryLex);
+  if (lex) {
+    // One id per pallet that can be in the truck at the same time (every
+    // pallet if some weigh nothing)
+    unsigned int lightest = UINT_MAX;
+    for (const Pallet &p : pallets)
+      lightest = std::min(lightest, p.get_weight());
+    std::size_t ids = lightest == UINT_MAX ? 0
+                      : lightest == 0
+                          ? n
+                          : std::min<std::size_t>(n, max_weight / lightest);
+    entry += ids * sizeof(std::string);
+  }
+  std::size_t rows = saturating_mul(2 * cols, entry);
+  std::size_t bits = decision_bytes(n, cols);
+  std::size_t profits = profit_sum(pallets) + 1;
+  std::size_t profit_indexed =
+      saturating_add(saturating_mul(profits, sizeof(MinWeightState)),
+                     decision_bytes(n, profits));
+  unsigned int threads =
+      num_threads ? num_threads
+                  : std::max(1u, std::thread::hardware_concurrency());
+
+  std::vector<std::pair<TableType, std::size_t>> candidates;
+  unsigned long long ratio_num = 0, ratio_den = 1;
+  if (!draw_condition && subset_sum_detection &&
+      profit_ratio(pallets, ratio_num, ratio_den))
+    candidates.push_back(
+        {TableType::SubsetSum,
+         saturating_add(decision_bytes(1, cols),
+                        saturating_mul(cols, sizeof(unsigned int)))});
+  bool prefers = !lex && prefers_profit_indexing(pallets, max_weight);
+  if (prefers)
+    candidates.push_back({TableType::ProfitIndexed, profit_indexed});
+  if (threads > 1 && !canonical)
+    candidates.push_back({TableType::Parallel, saturating_add(rows, bits)});
+  candidates.push_back(
+      {TableType::Bitset,
+       canonical ? saturating_add(saturating_mul(2 * cols,
+                                                 sizeof(std::int64_t)),
+                                  saturating_mul(2, bits))
+                 : saturating_add(rows, bits)});
+  if (!lex && !prefers && profits <= cols)
+    candidates.push_back({TableType::ProfitIndexed, profit_indexed});
+  candidates.push_back(
+      {TableType::OutOfCore,
+       saturating_add(rows,
+                      std::min(bits, DecisionBitset::WRITEBACK_CHUNK))});
+
+  std::string budget_str =
+      memory_budget ? format_memory(memory_budget) : "no limit";
+  std::string rejected;
+  for (const auto &[type, bytes] : candidates) {
+    if (memory_budget == 0 || bytes <= memory_budget) {
+      DPPlan plan;
+      plan.type = type;
+      plan.estimated_bytes = bytes;
+      plan.fits = true;
+      plan.summary = " | Plan: " + table_type_name(type) + " (estimated " +
+                     format_memory(bytes) + ", budget " + budget_str + ")";
+      if (!rejected.empty())
+        plan.summary += ", over budget: " + rejected;
+      return plan;
+    }
+    if (!rejected.empty())
+      rejected += ", ";
+    rejected += table_type_name(type) + " " + format_memory(bytes);
+  }
+  DPPlan plan;
+  plan.type = candidates.back().first;
+  plan.estimated_bytes = candidates.back().second;
+  plan.summary = " | No strategy fits the memory budget of " + budget_str +
+                 " (" + rejected + ")";
+  return plan;
+}
+
+DPPlan DynamicProgramming::plan(const std::vector<Pallet> &pallets,
+                                const Truck &truck) const {
+  InstanceReduction fixing(pallets, truck.get_capacity(),
+                           !(draw_condition && lexicographical_order),
+                           item_fixing);
+  WeightReduction reduction(fixing.get_pallets(), fixing.get_capacity(),
+                            weight_reduction);
+  return plan_table(reduction.get_pallets(), reduction.get_capacity());
 }
 
-// --- Dispatcher: always uses polymorphic interface ---
+// Helper: engines that run over two rolling rows with a row kernel
+static bool is_row_engine(TableType type) {
+  return type == TableType::Bitset || type == TableType::Parallel ||
+         type == TableType::OutOfCore || type == TableType::Tiled;
+}
+
+// --- Runs one of the rolling-row engines with a row kernel ---
+template <class Kernel>
+unsigned int DynamicProgramming::dp_solve_rows(
+    const Kernel &kernel, const std::vector<Pallet> &pallets,
+    unsigned int max_weight, std::vector<Pallet> &used_pallets, TableType type,
+    SolveBudget &budget, DPRunStats &stats) {
+  if (type == TableType::Parallel)
+    return dp_solve_parallel(kernel, pallets, max_weight, used_pallets,
+                             budget, stats);
+  if (type == TableType::Tiled)
+    return dp_solve_tiled(kernel, pallets, max_weight, used_pallets, budget,
+                          stats);
+  return dp_solve_bitset(kernel, pallets, max_weight, used_pallets, budget,
+                         stats, type == TableType::OutOfCore);
+}
+
+// --- Creates the table and runs the kernel for one fixed entry policy ---
+template <class Policy>
+unsigned int DynamicProgramming::dp_solve_policy(
+    const std::vector<Pallet> &pallets, unsigned int max_weight,
+    std::vector<Pallet> &used_pallets, TableType type,
+    SolveBudget &budget,
+    DPRunStats &stats) {
+  using Entry = typename Policy::Entry;
+  if (is_row_engine(type))
+    return dp_solve_rows(PolicyRowKernel<Policy>{}, pallets, max_weight,
+                         used_pallets, type, budget, stats);
+  unsigned int n = pallets.size();
+  auto dp = create_table(type, n, max_weight);
+  Entry result = Policy::empty();
+  if (type == TableType::Flat) {
+    auto &flat = static_cast<FlatDPTable<Entry> &>(*dp);
+    result = dp_solve_bottom_up<Policy>(pallets, flat, n, max_weight,
+                                        used_pallets, budget);
+  } else if (type == TableType::Vector) {
+    PolymorphicTableView<Entry> view(*dp);
+    result = dp_solve_bottom_up<Policy>(pallets, view, n, max_weight,
+                                        used_pallets, budget);
+  } else if (type == TableType::IterativeHashMap) {
+    auto &memo = static_cast<OpenAddressingDPTable<Entry> &>(*dp);
+    result = dp_solve_top_down_iterative<Policy>(pallets, memo, n, max_weight,
+                                                 used_pallets, budget);
+  } else {
+    auto &memo = static_cast<OpenAddressingDPTable<Entry> &>(*dp);
+    result = dp_solve_top_down<Policy>(pallets, memo, n, max_weight,
+                                       used_pallets, budget);
+  }
+  stats.num_entries = dp->get_num_entries();
+  stats.memory = dp->get_memory_usage();
+  return result.profit;
+}
+
+// Helper: tie-breaking modes, for messages
+static std::string tie_breaking_str(bool draw_condition,
+                                    bool lexicographical_order) {
+  if (!draw_condition)
+    return " | Draw condition: OFF";
+  if (lexicographical_order)
+    return " | Draw condition: ON (Lexicographical: ON)";
+  return " | Draw condition: ON (Lexicographical: OFF)";
+}
+
+// --- Dispatcher: picks the entry policy once, before any cell is computed ---
 unsigned int DynamicProgramming::dp_solve(const std::vector<Pallet> &pallets,
                                           const Truck &truck,
                                           std::vector<Pallet> &used_pallets,
                                           TableType type, std::string &message,
-                                          unsigned int timeout_ms) {
+                                          unsigned int timeout_ms,
+                                          const CancellationToken *cancel) {
   auto start_time = std::chrono::steady_clock::now();
-  auto deadline = start_time + std::chrono::milliseconds(timeout_ms);
-  auto dp = create_table(type, pallets.size(), truck.get_capacity());
-  unsigned int n = pallets.size();
-  unsigned int max_weight = truck.get_capacity();
-  bool timed_out = false;
-  std::unique_ptr<DPEntryBase> result;
-  if (type == TableType::Vector) {
-    result = dp_solve_bottom_up(pallets, dp, n, max_weight, used_pallets,
-                                deadline, timed_out);
-  } else {
-    result = dp_solve_top_down(pallets, dp, n, max_weight, used_pallets,
-                               deadline, timed_out);
+  SolveBudget budget(timeout_ms, cancel);
+  // Fixed-in pallets would shift the ids compared in lexicographical order
+  InstanceReduction fixing(pallets, truck.get_capacity(),
+                           !(draw_condition && lexicographical_order),
+                           item_fixing);
+  WeightReduction reduction(fixing.get_pallets(), fixing.get_capacity(),
+                            weight_reduction);
+  const std::vector<Pallet> &items = reduction.get_pallets();
+  unsigned int max_weight = reduction.get_capacity();
+  DPRunStats stats;
+  bool lex = draw_condition && lexicographical_order;
+
+  // Engine actually run: the planner's choice for Auto; dense tables give
+  // way to profit indexing when the profit axis is much shorter, which cannot
+  // track ids (lexicographical)
+  TableType engine = type;
+  std::string engine_note;
+  bool dense = type == TableType::Vector || type == TableType::Flat ||
+               type == TableType::Bitset || type == TableType::Parallel ||
+               type == TableType::OutOfCore || type == TableType::Tiled;
+  // Profit = c x weight: the heaviest feasible load is optimal. Reachable
+  // loads do not say how many pallets reach them, so not with the draw
+  // condition (TableType::Auto leaves the choice to the planner)
+  unsigned long long ratio_num = 0, ratio_den = 1;
+  bool proportional =
+      !draw_condition && profit_ratio(items, ratio_num, ratio_den);
+  bool subset_sum = proportional && (type == TableType::SubsetSum ||
+                                     (subset_sum_detection && dense));
+  if (subset_sum) {
+    engine = TableType::SubsetSum;
+  } else if (type == TableType::SubsetSum) {
+    engine = TableType::Bitset;
+    engine_note = draw_condition
+                      ? " | Subset-Sum Bitset does not count pallets (draw "
+                        "condition), ran Bitset instead"
+                      : " | Profits are not proportional to weights, ran "
+                        "Bitset instead";
+  } else if (type == TableType::Auto) {
+    DPPlan plan = plan_table(items, max_weight);
+    if (!plan.fits) {
+      used_pallets.clear();
+      message = "[DP (Auto)]" + plan.summary;
+      return 0;
+    }
+    engine = plan.type;
+    engine_note = plan.summary;
+  }
+  if (!subset_sum && dense && auto_profit_indexing && !lex &&
+      prefers_profit_indexing(items, max_weight)) {
+    engine = TableType::ProfitIndexed;
+    engine_note = " | Auto-selected instead of " + table_type_name(type) +
+                  " (profit sum " + std::to_string(profit_sum(items)) +
+                  " << capacity " + std::to_string(max_weight) + ")";
+  } else if (type == TableType::ProfitIndexed && lex) {
+    engine = TableType::Bitset;
+    engine_note = " | Profit-Indexed does not track ids, ran Bitset instead";
+  } else if (type == TableType::WeightClass && lex) {
+    engine = TableType::Bitset;
+    engine_note = " | Weight-Class does not track ids, ran Bitset instead";
   }
+  if (engine == TableType::SubsetSum)
+    engine_note += " | Subset-sum instance: profit = " +
+                   std::to_string(ratio_num) +
+                   (ratio_den > 1 ? "/" + std::to_string(ratio_den) : "") +
+                   " x weight";
+
+  unsigned int result;
+  if (engine == TableType::SubsetSum)
+    result = dp_solve_subset_sum(items, max_weight, used_pallets, budget,
+                                 stats);
+  else if (engine == TableType::ProfitIndexed)
+    result = dp_solve_profit_indexed(items, max_weight, used_pallets,
+                                     budget, stats);
+  else if (engine == TableType::WeightClass && !draw_condition &&
+           profit_sum(items) <= UINT_MAX)
+    result = dp_solve_weight_classes(items, max_weight, nullptr, used_pallets,
+                                     budget, stats);
+  else if (engine == TableType::WeightClass && !draw_condition) {
+    // Exact 64-bit profits would not wrap like the unsigned ones
+    engine = TableType::Bitset;
+    result = dp_solve_policy<SimplePolicy>(items, max_weight, used_pallets,
+                                           engine, budget, stats);
+    engine_note += " | Profit sum does not fit, ran Bitset instead";
+  } else if (engine == TableType::WeightClass) {
+    // The draw order is merged as packed keys, which must fit
+    PackedDrawKey key(items, max_weight);
+    if (key.fits()) {
+      result = dp_solve_weight_classes(items, max_weight, &key, used_pallets,
+                                       budget, stats);
+      engine_note += key.describe();
+    } else {
+      engine = TableType::Bitset;
+      result = dp_solve_policy<DrawPolicy>(items, max_weight, used_pallets,
+                                           engine, budget, stats);
+      engine_note += " | Packed draw key does not fit, ran Bitset instead";
+    }
+  }
+  else if (!draw_condition)
+    result = dp_solve_policy<SimplePolicy>(items, max_weight, used_pallets,
+                                           engine, budget, stats);
+  else if (!lexicographical_order && packed_draw_key &&
+           is_row_engine(engine)) {
+    // Draw order as one 64-bit max when the packed key fits
+    PackedDrawKey key(items, max_weight);
+    if (key.fits()) {
+      result = dp_solve_rows(
+          PackedDrawRowKernel{key, DPKernels::detect_isa()}, items,
+          max_weight, used_pallets, engine, budget, stats);
+      engine_note += key.describe();
+    } else {
+      result = dp_solve_policy<DrawPolicy>(items, max_weight, used_pallets,
+                                           engine, budget, stats);
+      engine_note += " | Packed draw key does not fit, ran unpacked";
+    }
+  } else if (!lexicographical_order)
+    result = dp_solve_policy<DrawPolicy>(items, max_weight, used_pallets,
+                                         engine, budget, stats);
+  else if (canonical_lex && engine == TableType::Bitset) {
+    // Draw keys without ids, then the smallest ids in a separate pass
+    PackedDrawKey key(items, max_weight);
+    if (key.fits()) {
+      result = dp_solve_lex_canonical(items, max_weight, key, used_pallets,
+                                      budget, stats);
+      engine_note += key.describe();
+    } else {
+      result = dp_solve_policy<LexPolicy>(items, max_weight, used_pallets,
+                                          engine, budget, stats);
+      engine_note += " | Packed draw key does not fit, ran with id vectors";
+    }
+  } else
+    result = dp_solve_policy<LexPolicy>(items, max_weight, used_pallets,
+                                        engine, budget, stats);
   auto end_time = std::chrono::steady_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
                       end_time - start_time)
                       .count();
-  std::size_t num_entries = dp->get_num_entries();
-  std::size_t memory = dp->get_memory_usage();
-  std::string memory_str;
-  if (memory < 1024)
-    memory_str = std::to_string(memory) + " B";
-  else if (memory < 1024 * 1024)
-    memory_str = std::to_string(memory / 1024) + " KB";
-  else
-    memory_str = std::to_string(memory / (1024 * 1024)) + " MB";
-  if (timed_out) {
-    message = "[DP (" +
-              std::string(type == TableType::Vector ? "Vector" : "HashMap") +
-              " Table)] Timeout after " + std::to_string(timeout_ms) + " ms.";
+  std::string memory_str = format_memory(stats.memory);
+  if (budget.is_exhausted()) {
+    message = "[DP (" + table_type_name(engine) + " Table)] " +
+              budget.stop_reason();
     return 0;
     }
-    std::string draw_str;
-    if (draw_condition) {
-      draw_str = " | Draw condition: ON";
-      if (lexicographical_order)
-        draw_str += " (Lexicographical: ON)";
-      else
-        draw_str += " (Lexicographical: OFF)";
-    } else {
-      draw_str = " | Draw condition: OFF";
-    }
-    message = "[DP (" +
-              std::string(type == TableType::Vector ? "Vector" : "HashMap") +
+    std::string draw_str = tie_breaking_str(draw_condition,
+                                            lexicographical_order);
+    reduction.restore(used_pallets);
+    fixing.restore(used_pallets);
+    message = "[DP (" + table_type_name(engine) +
               " Table)] Execution time: " + std::to_string(duration) +
-              " μs | Memory used for " + std::to_string(num_entries) +
-              " entries: " + memory_str + draw_str;
-    return result->get_profit();
+              " μs | Memory used for " + std::to_string(stats.num_entries) +
+              " entries: " + memory_str + draw_str + stats.details +
+              engine_note + fixing.describe() + reduction.describe();
+    return result + fixing.get_fixed_profit();
+}
+
+// --- Capacity sweep: one pass up to the largest capacity ---
+template <class Policy>
+bool DynamicProgramming::dp_sweep_policy(
+    const std::vector<Pallet> &pallets,
+    const std::vector<CapacityQuery> &queries, unsigned int max_weight,
+    CapacitySweep &sweep, SolveBudget &budget, DPRunStats &stats) {
+  using Entry = typename Policy::Entry;
+  unsigned int n = pallets.size();
+  std::size_t cols = static_cast<std::size_t>(max_weight) + 1;
+  std::size_t num_words = (cols + 63) / 64;
+  // Bits are only kept up to the largest capacity that is reconstructed
+  std::size_t bit_cols = 0;
+  for (const CapacityQuery &query : queries)
+    if (query.reconstruct)
+      bit_cols = std::max<std::size_t>(
+          bit_cols, static_cast<std::size_t>(query.capacity) + 1);
+  std::size_t bit_words = (bit_cols + 63) / 64;
+  const Entry empty = Policy::empty();
+  std::vector<Entry> prev(cols, empty);
+  std::vector<Entry> curr(cols, empty);
+  DecisionBitset taken(bit_cols ? n : 0, bit_cols, false);
+  // Bits of the words above bit_words are computed anyway, and dropped here
+  std::vector<std::uint64_t> discarded(num_words);
+  stats.num_entries = 2 * cols + n * bit_cols;
+  stats.memory = 2 * cols * sizeof(Entry) + taken.get_memory_usage() +
+                 num_words * sizeof(std::uint64_t);
+
+  for (unsigned int i = 1; i <= n; i++) {
+    if (budget.tick(cols))
+      return false;
+    if (bit_words)
+      policy_row_update<Policy>(prev.data(), curr.data(), pallets[i - 1],
+                                empty, cols, 0, bit_words,
+                                taken.row_words(i - 1));
+    policy_row_update<Policy>(prev.data(), curr.data(), pallets[i - 1], empty,
+                              cols, bit_words, num_words, discarded.data());
+    std::swap(prev, curr);
+  }
+
+  sweep.curve.resize(cols);
+  for (std::size_t w = 0; w < cols; w++)
+    sweep.curve[w] = prev[w].profit;
+  for (const CapacityQuery &query : queries) {
+    sweep.profits.push_back(prev[query.capacity].profit);
+    sweep.used_pallets.emplace_back();
+    if (query.reconstruct)
+      bitset_backtrack(pallets, taken, query.capacity,
+                       sweep.used_pallets.back());
+  }
+  return true;
+}
+
+unsigned int DynamicProgramming::dp_capacity_sweep(
+    const std::vector<Pallet> &pallets,
+    const std::vector<CapacityQuery> &queries, CapacitySweep &sweep,
+    std::string &message, unsigned int timeout_ms,
+    const CancellationToken *cancel) {
+  auto start_time = std::chrono::steady_clock::now();
+  SolveBudget budget(timeout_ms, cancel);
+  sweep = CapacitySweep();
+  unsigned int max_weight = 0;
+  std::size_t reconstructed = 0;
+  for (const CapacityQuery &query : queries) {
+    max_weight = std::max(max_weight, query.capacity);
+    reconstructed += query.reconstruct;
+  }
+  // Item fixing depends on the capacity; only pallets too heavy for every
+  // truck are left out
+  std::vector<Pallet> pallets_that_fit;
+  for (const Pallet &p : pallets)
+    if (p.get_weight() <= max_weight)
+      pallets_that_fit.push_back(p);
+  // Dividing by the GCD and capping at the total weight keeps every
+  // capacity: capacity c maps to cell min(c / GCD, reduced capacity)
+  WeightReduction reduction(pallets_that_fit, max_weight, weight_reduction);
+  const std::vector<Pallet> &items = reduction.get_pallets();
+  auto reduced = [&](unsigned int capacity) {
+    return std::min(capacity / reduction.get_divisor(),
+                    reduction.get_capacity());
+  };
+  std::vector<CapacityQuery> reduced_queries = queries;
+  for (CapacityQuery &query : reduced_queries)
+    query.capacity = reduced(query.capacity);
+  DPRunStats stats;
+
+  bool done;
+  if (!draw_condition)
+    done = dp_sweep_policy<SimplePolicy>(items, reduced_queries,
+                                         reduction.get_capacity(), sweep,
+                                         budget, stats);
+  else if (!lexicographical_order)
+    done = dp_sweep_policy<DrawPolicy>(items, reduced_queries,
+                                       reduction.get_capacity(), sweep,
+                                       budget, stats);
+  else
+    done = dp_sweep_policy<LexPolicy>(items, reduced_queries,
+                                      reduction.get_capacity(), sweep,
+                                      budget, stats);
+  auto end_time = std::chrono::steady_clock::now();
+  auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                      end_time - start_time)
+                      .count();
+  if (!done) {
+    sweep = CapacitySweep();
+    message = "[DP (Capacity Sweep)] " + budget.stop_reason();
+    return 0;
+  }
+  std::vector<unsigned int> reduced_curve;
+  reduced_curve.swap(sweep.curve);
+  sweep.curve.resize(static_cast<std::size_t>(max_weight) + 1);
+  for (unsigned int w = 0; w <= max_weight; w++)
+    sweep.curve[w] = reduced_curve[reduced(w)];
+  for (std::vector<Pallet> &used_pallets : sweep.used_pallets)
+    reduction.restore(used_pallets);
+  message = "[DP (Capacity Sweep)] Execution time: " +
+            std::to_string(duration) + " μs | Memory used for " +
+            std::to_string(stats.num_entries) +
+            " entries: " + format_memory(stats.memory) +
+            tie_breaking_str(draw_condition, lexicographical_order) +
+            " | Capacities: " + std::to_string(queries.size()) + " (up to " +
+            std::to_string(max_weight) + "), " +
+            std::to_string(reconstructed) + " reconstructed" +
+            reduction.describe();
+  return sweep.curve.back();
 }
 
 // --- Legacy 2-row DP (kept for reference, not polymorphic) ---
 unsigned int DynamicProgramming::dp_solve(const std::vector<Pallet> &pallets,
                                           const Truck &truck,
                                           std::string &message,
-                                          unsigned int timeout_ms) {
+                                          unsigned int timeout_ms,
+                                          const CancellationToken *cancel) {
   auto start_time = std::chrono::steady_clock::now();
-  auto deadline = start_time + std::chrono::milliseconds(timeout_ms);
+  SolveBudget budget(timeout_ms, cancel);
 
-  unsigned int n = pallets.size();
-  unsigned int W = truck.get_capacity();
+  InstanceReduction fixing(pallets, truck.get_capacity(), true, item_fixing);
+  WeightReduction reduction(fixing.get_pallets(), fixing.get_capacity(),
+                            weight_reduction);
+  const std::vector<Pallet> &items = reduction.get_pallets();
+  unsigned int n = items.size();
+  unsigned int W = reduction.get_capacity();
 
   // Two rows for rolling DP
   std::vector<unsigned int> prev(W + 1, 0);
@@ -267,14 +1361,13 @@ unsigned int DynamicProgramming::dp_solve(const std::vector<Pallet> &pallets,
 
   for (unsigned int i = 1; i <= n; ++i) {
     for (unsigned int w = 0; w <= W; ++w) {
-      if (std::chrono::steady_clock::now() > deadline) {
-        message = "[DP (2 Rolling Rows)] Timeout after " +
-                  std::to_string(timeout_ms) + " ms.";
+      if (budget.tick()) {
+        message = "[DP (2 Rolling Rows)] " + budget.stop_reason();
         return 0;
       }
-      if (pallets[i - 1].get_weight() <= w) {
+      if (items[i - 1].get_weight() <= w) {
         unsigned int include =
-            pallets[i - 1].get_profit() + prev[w - pallets[i - 1].get_weight()];
+            items[i - 1].get_profit() + prev[w - items[i - 1].get_weight()];
         unsigned int exclude = prev[w];
         curr[w] = std::max(include, exclude);
       } else {
@@ -292,18 +1385,311 @@ unsigned int DynamicProgramming::dp_solve(const std::vector<Pallet> &pallets,
   // Memory: two rows of (W+1) unsigned ints
   std::size_t num_entries = 2 * (W + 1);
   std::size_t memory = 2 * (W + 1) * sizeof(unsigned int);
-  std::string memory_str;
-  if (memory < 1024)
-    memory_str = std::to_string(memory) + " B";
-  else if (memory < 1024 * 1024)
-    memory_str = std::to_string(memory / 1024) + " KB";
-  else
-    memory_str = std::to_string(memory / (1024 * 1024)) + " MB";
+  std::string memory_str = format_memory(memory);
 
   message =
       "[DP (2 Rolling Rows)] Execution time: " + std::to_string(duration) +
       " μs | Memory used for " + std::to_string(num_entries) +
-      " entries: " + memory_str;
+      " entries: " + memory_str + fixing.describe() + reduction.describe();
+
+  // Note: `prev` holds the last filled row after final swap
+  return prev[W] + fixing.get_fixed_profit();
+}
+
+// --- Vectorized single rolling row (max profit only) ---
+
+// Cell width of the rolling-row engines: the narrowest unsigned type that
+// holds the sum of all profits (see DPKernels::cell_bits)
+static std::string cell_width_str(unsigned int bits) {
+  return std::to_string(bits) + "-bit cells";
+}
+
+// Exact profits beyond the unsigned return type are reported in the message
+static std::string exact_profit_str(std::uint64_t profit) {
+  if (profit <= UINT_MAX)
+    return "";
+  return " | Exact profit: " + std::to_string(profit) +
+         " (exceeds the 32-bit return value)";
+}
+
+// Helper: runs the rolling row with Cell-wide entries, returns false when the
+// budget stops it
+template <class Cell>
+static bool simd_rolling_row(const std::vector<Pallet> &items,
+                             unsigned int W, DPKernels::ISA isa,
+                             SolveBudget &budget, std::uint64_t &best) {
+  // Single row, updated in place from high to low capacities
+  std::vector<Cell> row(static_cast<std::size_t>(W) + 1, 0);
+  for (const Pallet &item : items) {
+    // The budget is charged once per item row, not per cell
+    if (budget.tick(static_cast<unsigned long long>(W) + 1))
+      return false;
+    DPKernels::add_item(row.data(), W, item.get_weight(),
+                        static_cast<Cell>(item.get_profit()), isa);
+  }
+  best = row[W];
+  return true;
+}
+
+unsigned int DynamicProgramming::dp_solve_simd(
+    const std::vector<Pallet> &pallets, const Truck &truck,
+    std::string &message, unsigned int timeout_ms,
+    const CancellationToken *cancel) {
+  auto start_time = std::chrono::steady_clock::now();
+  SolveBudget budget(timeout_ms, cancel);
+
+  InstanceReduction fixing(pallets, truck.get_capacity(), true, item_fixing);
+  WeightReduction reduction(fixing.get_pallets(), fixing.get_capacity(),
+                            weight_reduction);
+  const std::vector<Pallet> &items = reduction.get_pallets();
+  unsigned int n = items.size();
+  unsigned int W = reduction.get_capacity();
+  DPKernels::ISA isa = DPKernels::detect_isa();
+  unsigned int bits = DPKernels::cell_bits(profit_sum(items));
+  std::string label = "[DP (SIMD Rolling Row, " + DPKernels::isa_name(isa) +
+                      ", " + cell_width_str(bits) + ")]";
+
+  std::uint64_t best = 0;
+  bool done = bits == 16   ? simd_rolling_row<std::uint16_t>(items, W, isa,
+                                                             budget, best)
+              : bits == 32 ? simd_rolling_row<unsigned int>(items, W, isa,
+                                                            budget, best)
+                           : simd_rolling_row<std::uint64_t>(items, W, isa,
+                                                             budget, best);
+  if (!done) {
+    message = label + " " + budget.stop_reason();
+    return 0;
+  }
+
+  auto end_time = std::chrono::steady_clock::now();
+  auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                      end_time - start_time)
+                      .count();
+
+  // Throughput counts every (item, capacity) cell of the equivalent table
+  double cells = static_cast<double>(n) * (static_cast<double>(W) + 1);
+  double seconds = duration > 0 ? duration / 1e6 : 1e-6;
+  std::size_t num_entries = static_cast<std::size_t>(W) + 1;
+  std::size_t memory = num_entries * (bits / 8);
+  std::uint64_t profit = best + fixing.get_fixed_profit();
+
+  message = label + " Execution time: " + std::to_string(duration) +
+            " μs | Throughput: " +
+            std::to_string(static_cast<unsigned long long>(cells / seconds)) +
+            " cells/s | Memory used for " + std::to_string(num_entries) +
+            " entries: " + format_memory(memory) + exact_profit_str(profit) +
+            fixing.describe() + reduction.describe();
+
+  return static_cast<unsigned int>(profit);
+}
+
+// --- Hirschberg-style divide and conquer over the rolling-row kernel ---
+template <class Cell>
+void DynamicProgramming::dp_divide_and_conquer(
+    const std::vector<Pallet> &pallets, unsigned int lo, unsigned int hi,
+    unsigned int max_weight, DPKernels::ISA isa,
+    std::vector<unsigned int> &used,
+    SolveBudget &budget) {
+  if (budget.is_exhausted() || lo >= hi || max_weight == 0)
+    return;
+  if (hi - lo == 1) {
+    if (pallets[lo].get_weight() <= max_weight)
+      used.push_back(lo);
+    return;
+  }
+
+  unsigned int mid = lo + (hi - lo) / 2;
+  unsigned int split = 0;
+  {
+    // Best profit per capacity for the left and right halves
+    std::vector<Cell> left(static_cast<std::size_t>(max_weight) + 1, 0);
+    std::vector<Cell> right(static_cast<std::size_t>(max_weight) + 1, 0);
+    for (unsigned int i = lo; i < hi; ++i) {
+      if (budget.tick(static_cast<unsigned long long>(max_weight) + 1))
+        return;
+      std::vector<Cell> &row = i < mid ? left : right;
+      DPKernels::add_item(row.data(), max_weight, pallets[i].get_weight(),
+                          static_cast<Cell>(pallets[i].get_profit()), isa);
+    }
+    std::uint64_t best = 0;
+    for (unsigned int c = 0; c <= max_weight; ++c) {
+      std::uint64_t value =
+          static_cast<std::uint64_t>(left[c]) + right[max_weight - c];
+      if (value > best) {
+        best = value;
+        split = c;
+      }
+    }
+  } // Rows are released before recursing: peak memory stays O(W)
+
+  dp_divide_and_conquer<Cell>(pallets, lo, mid, split, isa, used, budget);
+  dp_divide_and_conquer<Cell>(pallets, mid, hi, max_weight - split, isa, used,
+                              budget);
+}
+
+unsigned int DynamicProgramming::dp_solve_divide_and_conquer(
+    const std::vector<Pallet> &pallets, const Truck &truck,
+    std::vector<Pallet> &used_pallets, std::string &message,
+    unsigned int timeout_ms, const CancellationToken *cancel) {
+  auto start_time = std::chrono::steady_clock::now();
+  SolveBudget budget(timeout_ms, cancel);
+
+  InstanceReduction fixing(pallets, truck.get_capacity(), true, item_fixing);
+  WeightReduction reduction(fixing.get_pallets(), fixing.get_capacity(),
+                            weight_reduction);
+  const std::vector<Pallet> &items = reduction.get_pallets();
+  unsigned int n = items.size();
+  unsigned int W = reduction.get_capacity();
+  DPKernels::ISA isa = DPKernels::detect_isa();
+  // Both halves are disjoint subsets: their sum also fits the cell width
+  unsigned int bits = DPKernels::cell_bits(profit_sum(items));
+  std::string label = "[DP (Divide and Conquer, " + DPKernels::isa_name(isa) +
+                      ", " + cell_width_str(bits) + ")]";
+
+  std::vector<unsigned int> used;
+  if (bits == 16)
+    dp_divide_and_conquer<std::uint16_t>(items, 0, n, W, isa, used, budget);
+  else if (bits == 32)
+    dp_divide_and_conquer<unsigned int>(items, 0, n, W, isa, used, budget);
+  else
+    dp_divide_and_conquer<std::uint64_t>(items, 0, n, W, isa, used, budget);
+
+  used_pallets.clear();
+  if (budget.is_exhausted()) {
+    message = label + " " + budget.stop_reason();
+    return 0;
+  }
+  std::uint64_t profit = 0;
+  for (unsigned int idx : used) {
+    used_pallets.push_back(fixing.get_pallets()[idx]);
+    profit += fixing.get_pallets()[idx].get_profit();
+  }
+  fixing.restore(used_pallets);
+  profit += fixing.get_fixed_profit();
+
+  auto end_time = std::chrono::steady_clock::now();
+  auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                      end_time - start_time)
+                      .count();
+
+  // Peak memory: the two half rows of the top level
+  std::size_t num_entries = 2 * (static_cast<std::size_t>(W) + 1);
+  std::size_t memory = num_entries * (bits / 8);
+
+  message = label + " Execution time: " + std::to_string(duration) +
+            " μs | Peak memory used for " + std::to_string(num_entries) +
+            " entries: " + format_memory(memory) + exact_profit_str(profit) +
+            fixing.describe() + reduction.describe();
+  return static_cast<unsigned int>(profit);
+}
+
+namespace {
+// Non-dominated state of the Pareto frontier
+struct ParetoPoint {
+  unsigned int weight;
+  unsigned int profit;
+};
+} // namespace
+
+// --- Sparse Pareto frontier (Nemhauser-Ullmann) with reconstruction ---
+unsigned int DynamicProgramming::dp_solve_pareto(
+    const std::vector<Pallet> &pallets, const Truck &truck,
+    std::vector<Pallet> &used_pallets, std::string &message,
+    unsigned int timeout_ms, const CancellationToken *cancel) {
+  auto start_time = std::chrono::steady_clock::now();
+  SolveBudget budget(timeout_ms, cancel);
+
+  InstanceReduction fixing(pallets, truck.get_capacity(), true, item_fixing);
+  WeightReduction reduction(fixing.get_pallets(), fixing.get_capacity(),
+                            weight_reduction);
+  const std::vector<Pallet> &items = reduction.get_pallets();
+  unsigned int n = items.size();
+  unsigned int W = reduction.get_capacity();
+
+  std::vector<ParetoPoint> frontier{{0, 0}};
+  std::vector<ParetoPoint> next;
+  // links[offsets[i] + k]: parent index (<< 1) and "taken" bit of the k-th
+  // state of frontier i + 1, all frontiers stored back to back
+  std::vector<unsigned int> links;
+  std::vector<std::size_t> offsets;
+  offsets.reserve(n + 1);
+  std::size_t peak = 1;
+
+  for (unsigned int i = 0; i < n; ++i) {
+    // Each item merges the whole frontier
+    if (budget.tick(frontier.size())) {
+      message = "[DP (Pareto Frontier)] " + budget.stop_reason();
+      return 0;
+    }
+    offsets.push_back(links.size());
+    unsigned long long pw = items[i].get_weight();
+    unsigned int pp = items[i].get_profit();
+    std::size_t size = frontier.size();
+    // States of the shifted copy that still fit: a prefix, since sorted
+    std::size_t fit = 0;
+    while (fit < size && frontier[fit].weight + pw <= W)
+      ++fit;
+
+    // Merge by weight; on equal weight the more profitable state comes first
+    // (ties go to the include side), and a state is kept only if it beats
+    // the profit of every lighter state already kept
+    next.clear();
+    std::size_t a = 0, b = 0;
+    while (a < size || b < fit) {
+      bool take;
+      ParetoPoint candidate;
+      if (b < fit) {
+        ParetoPoint shifted{
+            static_cast<unsigned int>(frontier[b].weight + pw),
+            frontier[b].profit + pp};
+        take = a == size || shifted.weight < frontier[a].weight ||
+               (shifted.weight == frontier[a].weight &&
+                shifted.profit >= frontier[a].profit);
+        candidate = take ? shifted : frontier[a];
+      } else {
+        take = false;
+        candidate = frontier[a];
+      }
+      std::size_t parent = take ? b++ : a++;
+      if (next.empty() || candidate.profit > next.back().profit) {
+        next.push_back(candidate);
+        links.push_back(static_cast<unsigned int>(parent << 1) | take);
+      }
+    }
+    std::swap(frontier, next);
+    peak = std::max(peak, frontier.size());
+  }
+
+  // The last state is the most profitable one that fits (and the lightest
+  // with that profit)
+  used_pallets.clear();
+  std::size_t k = frontier.size() - 1;
+  unsigned int profit = frontier[k].profit;
+  for (unsigned int i = n; i > 0; --i) {
+    unsigned int link = links[offsets[i - 1] + k];
+    if (link & 1)
+      used_pallets.push_back(fixing.get_pallets()[i - 1]);
+    k = link >> 1;
+  }
+  std::reverse(used_pallets.begin(), used_pallets.end());
+  fixing.restore(used_pallets);
+  profit += fixing.get_fixed_profit();
+
+  auto end_time = std::chrono::steady_clock::now();
+  auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                      end_time - start_time)
+                      .count();
+
+  std::size_t num_entries = links.size();
+  std::size_t memory = links.size() * sizeof(unsigned int) +
+                       offsets.size() * sizeof(std::size_t) +
+                       2 * peak * sizeof(ParetoPoint);
 
-  return prev[W]; // Note: `prev` holds the last filled row after final swap
+  message = "[DP (Pareto Frontier)] Execution time: " +
+            std::to_string(duration) + " μs | Pareto states: " +
+            std::to_string(num_entries) + " (peak frontier " +
+            std::to_string(peak) + ") | Memory used for " +
+            std::to_string(num_entries) + " entries: " +
+            format_memory(memory) + fixing.describe() + reduction.describe();
+  return profit;
 }
@@ -10,12 +10,73 @@
 
 #include "../../DataStructures/Pallet.h"
 #include "../../DataStructures/Truck.h"
+#include "../SolveBudget.h"
 #include "DPEntry.h"
+#include "DPKernels.h"
+#include "DPPackedKey.h"
+#include "DPPolicies.h"
 #include "DPTable.h"
-#include "HashMapDPTable.h"
+#include "DecisionBitset.h"
+#include "FlatDPTable.h"
+#include "OpenAddressingDPTable.h"
 #include "VectorDPTable.h"
 
-enum class TableType { Vector, HashMap };
+enum class TableType {
+  Vector,
+  HashMap,
+  Flat,
+  Bitset,
+  Parallel,
+  ProfitIndexed,
+  IterativeHashMap,
+  OutOfCore,
+  Tiled,
+  SubsetSum,
+  WeightClass,
+  Auto
+};
+
+/**
+ * @struct DPRunStats
+ * @brief Table statistics reported by a DP engine for the result message.
+ */
+struct DPRunStats {
+  std::size_t num_entries = 0; ///< Number of stored entries (or cells)
+  std::size_t memory = 0;      ///< Memory used in bytes
+  std::string details;         ///< Engine-specific suffix for the message
+};
+
+/**
+ * @struct DPPlan
+ * @brief Strategy picked by the memory planner for TableType::Auto.
+ */
+struct DPPlan {
+  TableType type = TableType::OutOfCore; ///< Fastest strategy that fits
+  std::size_t estimated_bytes = 0;       ///< Estimated peak memory of type
+  bool fits = false;          ///< False if no strategy fits the budget
+  std::string summary;        ///< Chosen and rejected strategies, for messages
+};
+
+/**
+ * @struct CapacityQuery
+ * @brief One truck of a capacity sweep.
+ */
+struct CapacityQuery {
+  unsigned int capacity = 0; ///< Truck capacity
+  bool reconstruct = true;   ///< If false, only the profit is reported
+};
+
+/**
+ * @struct CapacitySweep
+ * @brief Answers of DynamicProgramming::dp_capacity_sweep.
+ */
+struct CapacitySweep {
+  std::vector<unsigned int> profits; ///< Maximum profit of every query
+  /// Selected pallets of every query (empty if not reconstructed)
+  std::vector<std::vector<Pallet>> used_pallets;
+  /// Maximum profit for every capacity 0..(largest queried capacity)
+  std::vector<unsigned int> curve;
+};
 
 /**
  * @class DynamicProgramming
@@ -26,91 +87,514 @@ enum class TableType { Vector, HashMap };
  * approaches.
  *
  * - DP Vector: O(nW) time, O(nW) space (can reconstruct solution).
+ * - DP Flat: same as DP Vector, but entries are stored by value in a single
+ *   contiguous buffer (no per-cell allocation).
+ * - DP Bitset: O(nW) time, two rolling rows of entries plus one "taken" bit
+ *   per (i, w), i.e. O(W) entries + nW/8 bytes (can reconstruct solution).
+ * - DP Parallel: DP Bitset with each row's capacity range split across a
+ *   fixed pool of threads, O(nW / p) time.
+ * - DP Out-of-Core: DP Bitset whose decision bits are streamed to a
+ *   memory-mapped scratch file, O(W) entries in memory plus nW/8 bytes on
+ *   disk, for instances whose decisions do not fit in RAM.
+ * - DP Tiled: DP Bitset with blocks of k pallets applied to one cache-sized
+ *   tile of capacities at a time, O(kW) entries + nW/8 bytes (see
+ *   set_tiling()).
+ * - DP Subset-Sum: for profit = c x weight, a bitset of reachable loads,
+ *   O(nW / 64) time, O(W) space (can reconstruct solution). Chosen
+ *   automatically instead of the dense tables (draw condition off).
+ * - DP Weight-Class: one max-plus merge per distinct weight, O(dW log W)
+ *   time, O(dW) space for d distinct weights (can reconstruct solution).
+ * - DP Auto: the fastest of the above that fits a memory budget (see
+ *   set_memory_budget() and plan()).
+ * - DP Capacity Sweep: one bottom-up pass up to the largest of many truck
+ *   capacities answers every truck from the last row, plus the optimum for
+ *   every capacity in between (see dp_capacity_sweep()).
+ * - DP Profit-Indexed: O(nP) time, where P is the sum of all profits, one
+ *   row of (P + 1) minimum weights plus nP/8 bytes of decisions (can
+ *   reconstruct solution). Chosen automatically instead of the dense tables
+ *   when P is much smaller than the capacity.
  * - DP HashMap: O(s) time, O(s) space, where s is the number of unique (i, w)
- *   states (sparse for some datasets).
+ *   states (sparse for some datasets), memoized in an open-addressing table
+ *   with entries stored inline.
+ * - DP Iterative HashMap: same states as DP HashMap, computed from an explicit
+ *   work stack (no recursion depth limit, no allocation per call).
  * - DP Optimized (2 rows): O(nW) time, O(W) space (only computes max profit, no
  *   reconstruction).
+ * - DP SIMD (1 row): O(nW / lanes) time, O(W) space (vectorized single-row
+ *   update, only computes max profit).
+ * - DP Divide and Conquer (Hirschberg): O(nW log n / lanes) time, usually
+ *   about 2x DP SIMD, O(W) space (reconstructs solution, profit only).
+ * - DP Pareto (Nemhauser-Ullmann): O(sum of frontier sizes) time and space,
+ *   keeps only non-dominated (weight, profit) states, so the cost does not
+ *   grow with W (reconstructs solution, profit only).
+ *
+ * Every mode first applies InstanceReduction (item fixing by bounds), then
+ * WeightReduction on the residual pallets. Neither changes the optimal
+ * profit. WeightReduction never changes the selected pallets. Item fixing
+ * keeps the set of optimal solutions, but the DP may pick a different one
+ * among ties. With lexicographical order only pallets that are in no
+ * optimal solution are removed, so the chosen set is unchanged.
  *
  * @note By default, only profit, weight, and count are used for tie-breaking.
  *       If lexicographical tie-breaking is enabled via set_lexicographical_order(true),
  *       the DP will also track and compare the set of pallet IDs for the lexicographically
- *       smallest solution. This increases memory usage and should only be enabled for small
- *       problem sizes where full optimality (including lexicographical order) is required.
+ *       smallest solution. DP Bitset finds it without ids in the cells (a draw DP, then a
+ *       canonical pass, see set_canonical_lex()); the other tables copy the ids into every
+ *       cell, which increases memory usage and should only be used for small problem sizes.
  */
 class DynamicProgramming {
 private:
   bool lexicographical_order =
       false; ///< If true, use lexicographical tie-breaking (track ids)
   bool draw_condition = false;
+  unsigned int num_threads =
+      0; ///< Worker threads for TableType::Parallel (0: hardware concurrency)
+  bool auto_profit_indexing =
+      true; ///< If true, dense table types may switch to profit indexing
+  bool packed_draw_key =
+      true; ///< If true, draw rows are 64-bit keys when they fit
+  bool subset_sum_detection =
+      true; ///< If true, profit = c x weight instances run as subset sums
+  bool canonical_lex =
+      true; ///< If true, lexicographical Bitset runs on keys (no id vectors)
+  bool weight_reduction =
+      true; ///< If true, capacity and weights are reduced (WeightReduction)
+  bool item_fixing =
+      true; ///< If true, pallets are fixed by bounds (InstanceReduction)
+  std::string scratch_directory; ///< Directory for TableType::OutOfCore
+                                 ///< scratch files (empty: system temp dir)
+  std::size_t memory_budget =
+      0; ///< Peak bytes allowed to TableType::Auto (0: no limit)
+  unsigned int tile_items =
+      0; ///< Pallets per block of TableType::Tiled (0: automatic)
+  unsigned int tile_width =
+      0; ///< Capacity cells per tile of TableType::Tiled (0: automatic)
 
   /**
    * @brief Creates a DP table of the specified type.
-   * @param type TableType::Vector or TableType::HashMap
+   * @param type TableType::Vector, TableType::HashMap, TableType::Flat or
+   * TableType::IterativeHashMap
    * @param n Number of items
    * @param max_weight Maximum capacity
    * @return Unique pointer to DPTable
+   * @throws std::invalid_argument for TableType::Bitset (no full table)
    */
   std::unique_ptr<DPTable> create_table(TableType type, unsigned int n,
                                         unsigned int max_weight);
 
-  // --- Polymorphic DP interface ---
+  // --- Templated DP kernels (Policy: SimplePolicy, DrawPolicy, LexPolicy;
+  // Table: FlatDPTable<Entry> or PolymorphicTableView<Entry>) ---
+  /**
+   * @brief Creates the table for the given type and runs the matching kernel
+   * with a fixed entry policy.
+   * @param pallets List of pallets
+   * @param max_weight Maximum capacity
+   * @param used_pallets Output: selected pallets
+   * @param type TableType::Vector, TableType::HashMap, TableType::Flat,
+   * TableType::Bitset, TableType::Parallel, TableType::IterativeHashMap or
+   * TableType::OutOfCore
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @param stats Output: table statistics
+   * @return Maximum profit
+   */
+  template <class Policy>
+  unsigned int dp_solve_policy(const std::vector<Pallet> &pallets,
+                               unsigned int max_weight,
+                               std::vector<Pallet> &used_pallets,
+                               TableType type,
+                               SolveBudget &budget, DPRunStats &stats);
+
+  /**
+   * @brief Bottom-up DP up to the largest queried capacity, answering every
+   * query from the last row, for one fixed entry policy.
+   * @param pallets List of pallets
+   * @param queries Trucks to answer
+   * @param max_weight Largest queried capacity
+   * @param sweep Output: profits, selections and profit curve
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @param stats Output: table statistics for the message
+   * @return False if the budget ran out
+   */
+  template <class Policy>
+  bool dp_sweep_policy(const std::vector<Pallet> &pallets,
+                       const std::vector<CapacityQuery> &queries,
+                       unsigned int max_weight, CapacitySweep &sweep,
+                       SolveBudget &budget, DPRunStats &stats);
+
   /**
    * @brief Top-down DP with memoization (HashMap), computes only max profit.
    * @param pallets List of pallets
-   * @param dp DPTable (HashMap)
+   * @param dp Typed memo table (OpenAddressingDPTable)
    * @param i Current item index
    * @param w Remaining capacity
-   * @param deadline Timeout deadline
-   * @param timed_out Set to true if timeout occurs
-   * @return Pointer to DPEntryBase (polymorphic base class)
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @return Entry for subproblem (i, w), by value
    * @details
    * Time complexity: O(s), where s is the number of unique (i, w) states.
    * Space complexity: O(s).
    */
-  std::unique_ptr<DPEntryBase> dp_solve_top_down(
-      const std::vector<Pallet> &pallets, std::unique_ptr<DPTable> &dp,
-      unsigned int i, unsigned int w,
-      std::chrono::steady_clock::time_point deadline, bool &timed_out);
+  template <class Policy, class Table>
+  typename Policy::Entry
+  dp_solve_top_down(const std::vector<Pallet> &pallets, Table &dp,
+                    unsigned int i, unsigned int w,
+                    SolveBudget &budget);
 
   /**
    * @brief Top-down DP with memoization (HashMap), reconstructs used pallets.
    * @param pallets List of pallets
-   * @param dp DPTable (HashMap)
+   * @param dp Typed memo table (OpenAddressingDPTable)
    * @param i Current item index
    * @param w Remaining capacity
    * @param used_pallets Output: selected pallets
-   * @param deadline Timeout deadline
-   * @param timed_out Set to true if timeout occurs
-   * @return Pointer to DPEntryBase (polymorphic base class)
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @return Entry for subproblem (i, w), by value
    * @details
    * Time complexity: O(s), where s is the number of unique (i, w) states.
    * Space complexity: O(s).
    */
-  std::unique_ptr<DPEntryBase> dp_solve_top_down(
-      const std::vector<Pallet> &pallets, std::unique_ptr<DPTable> &dp,
-      unsigned int i, unsigned int w, std::vector<Pallet> &used_pallets,
-      std::chrono::steady_clock::time_point deadline, bool &timed_out);
+  template <class Policy, class Table>
+  typename Policy::Entry
+  dp_solve_top_down(const std::vector<Pallet> &pallets, Table &dp,
+                    unsigned int i, unsigned int w,
+                    std::vector<Pallet> &used_pallets,
+                    SolveBudget &budget);
+
+  /**
+   * @brief Top-down DP with memoization driven by an explicit work stack
+   * instead of recursion, reconstructs used pallets.
+   * @param pallets List of pallets
+   * @param dp Typed memo table (find()/put() by value, e.g.
+   * OpenAddressingDPTable)
+   * @param n Number of items
+   * @param max_weight Maximum capacity
+   * @param used_pallets Output: selected pallets
+   * @param budget Time and cancellation budget (one tick per state)
+   * @return Entry for (n, max_weight), by value
+   * @details
+   * Visits the same states as dp_solve_top_down and breaks ties the same way.
+   * A frame is expanded once (its missing children are pushed) and resolved
+   * once both children are memoized, so the stack never holds more than
+   * 2n + 1 frames. Every state on the reconstruction path has both children
+   * memoized, so backtracking only reads the table.
+   * Time complexity: O(s), where s is the number of unique (i, w) states.
+   * Space complexity: O(s + n).
+   */
+  template <class Policy, class Table>
+  typename Policy::Entry
+  dp_solve_top_down_iterative(const std::vector<Pallet> &pallets, Table &dp,
+                              unsigned int n, unsigned int max_weight,
+                              std::vector<Pallet> &used_pallets,
+                              SolveBudget &budget);
+
+  /**
+   * @brief Returns the memoized entry for (i, w), computing it (without
+   * timeout checks) if missing. Used while backtracking the top-down DP.
+   * @param pallets List of pallets
+   * @param dp Typed memo table (OpenAddressingDPTable)
+   * @param i Item index
+   * @param w Remaining capacity
+   * @return Reference to the stored entry
+   */
+  template <class Policy, class Table>
+  const typename Policy::Entry &
+  dp_get_or_compute(const std::vector<Pallet> &pallets, Table &dp,
+                    unsigned int i, unsigned int w);
 
   /**
-   * @brief Bottom-up DP (vector table), reconstructs used pallets.
+   * @brief Bottom-up DP (vector or flat table), reconstructs used pallets.
    * @param pallets List of pallets
-   * @param dp DPTable (Vector)
+   * @param dp Typed table (FlatDPTable or view over VectorDPTable)
    * @param n Number of items
    * @param max_weight Maximum capacity
    * @param used_pallets Output: selected pallets
-   * @param deadline Timeout deadline
-   * @param timed_out Set to true if timeout occurs
-   * @return Pointer to DPEntryBase (polymorphic base class)
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @return Entry for (n, max_weight), by value
    * @details
    * Time complexity: O(nW)
    * Space complexity: O(nW)
    */
-  std::unique_ptr<DPEntryBase>
-  dp_solve_bottom_up(const std::vector<Pallet> &pallets,
-                     std::unique_ptr<DPTable> &dp, unsigned int n,
-                     unsigned int max_weight, std::vector<Pallet> &used_pallets,
-                     std::chrono::steady_clock::time_point deadline,
-                     bool &timed_out);
+  template <class Policy, class Table>
+  typename Policy::Entry
+  dp_solve_bottom_up(const std::vector<Pallet> &pallets, Table &dp,
+                     unsigned int n, unsigned int max_weight,
+                     std::vector<Pallet> &used_pallets,
+                     SolveBudget &budget);
+
+  /**
+   * @brief Bottom-up DP over two rolling rows of entries that records one
+   * "taken" bit per (i, w) and reconstructs by walking the bits back.
+   * @param kernel Row kernel: PolicyRowKernel or PackedDrawRowKernel
+   * @param pallets List of pallets
+   * @param max_weight Maximum capacity
+   * @param used_pallets Output: selected pallets
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @param stats Output: stored entries and decision bits, rows plus packed
+   * bits in bytes (for out-of-core, the bits kept in memory)
+   * @param out_of_core If true, the bits are written to a memory-mapped
+   * scratch file in scratch_directory and read back from it while
+   * reconstructing
+   * @return Maximum profit
+   * @throws std::runtime_error if the scratch file cannot be created
+   * @details
+   * The bit is set when including item i is at least as good as excluding
+   * it, which is exactly the condition the table-based backtracking tests,
+   * so the selected pallets are identical to DP Vector's.
+   * Time complexity: O(nW)
+   * Space complexity: O(W) entries + nW/8 bytes (on disk if out_of_core)
+   */
+  template <class Kernel>
+  unsigned int dp_solve_bitset(const Kernel &kernel,
+                               const std::vector<Pallet> &pallets,
+                               unsigned int max_weight,
+                               std::vector<Pallet> &used_pallets,
+                               SolveBudget &budget, DPRunStats &stats,
+                               bool out_of_core = false);
+
+  /**
+   * @brief Row-parallel version of dp_solve_bitset: each row's capacity range
+   * is split into word-aligned slices processed by a fixed pool of threads,
+   * synchronized by one barrier per row.
+   * @param kernel Row kernel: PolicyRowKernel or PackedDrawRowKernel
+   * @param pallets List of pallets
+   * @param max_weight Maximum capacity
+   * @param used_pallets Output: selected pallets
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @param stats Output: table statistics, thread count and parallel
+   * efficiency (share of thread time spent computing cells)
+   * @return Maximum profit
+   * @details
+   * Each worker first-touches its own slice of the rolling rows and of the
+   * decision bits (NUMA-friendly placement). The selected pallets are
+   * identical to dp_solve_bitset's.
+   * Time complexity: O(nW / p + n) with p threads
+   * Space complexity: O(W) entries + nW/8 bytes
+   */
+  template <class Kernel>
+  unsigned int dp_solve_parallel(const Kernel &kernel,
+                                 const std::vector<Pallet> &pallets,
+                                 unsigned int max_weight,
+                                 std::vector<Pallet> &used_pallets,
+                                 SolveBudget &budget, DPRunStats &stats);
+
+  /**
+   * @brief Cache-blocked version of dp_solve_bitset: a block of k pallets is
+   * applied to one tile of capacities at a time, keeping k + 1 rows, so the
+   * k intermediate rows of a tile stay in cache instead of streaming every
+   * row through memory.
+   * @param kernel Row kernel: PolicyRowKernel or PackedDrawRowKernel
+   * @param pallets List of pallets
+   * @param max_weight Maximum capacity
+   * @param used_pallets Output: selected pallets
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @param stats Output: table statistics, tile shape and estimated row
+   * traffic against the rolling rows
+   * @return Maximum profit
+   * @details
+   * Tiles go from low to high capacities and, within a tile, row j + 1 only
+   * reads cells of row j at or below the tile, which are already final. The
+   * "taken" bits and the selected pallets are identical to dp_solve_bitset's.
+   * Time complexity: O(nW)
+   * Space complexity: O(kW) entries + nW/8 bytes
+   */
+  template <class Kernel>
+  unsigned int dp_solve_tiled(const Kernel &kernel,
+                              const std::vector<Pallet> &pallets,
+                              unsigned int max_weight,
+                              std::vector<Pallet> &used_pallets,
+                              SolveBudget &budget, DPRunStats &stats);
+
+  /**
+   * @brief Runs the rolling-row engine of a table type with a row kernel.
+   * @param kernel Row kernel: PolicyRowKernel or PackedDrawRowKernel
+   * @param pallets List of pallets
+   * @param max_weight Maximum capacity
+   * @param used_pallets Output: selected pallets
+   * @param type TableType::Bitset, TableType::Parallel,
+   * TableType::OutOfCore or TableType::Tiled
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @param stats Output: table statistics for the message
+   * @return Maximum profit
+   */
+  template <class Kernel>
+  unsigned int dp_solve_rows(const Kernel &kernel,
+                             const std::vector<Pallet> &pallets,
+                             unsigned int max_weight,
+                             std::vector<Pallet> &used_pallets, TableType type,
+                             SolveBudget &budget, DPRunStats &stats);
+
+  /**
+   * @brief Profit-indexed DP: for every total profit q in [0, P], keeps the
+   * minimum weight (then, with the draw condition, the minimum count) that
+   * reaches exactly q, plus one "taken" bit per (i, q) for reconstruction.
+   * @param pallets List of pallets
+   * @param max_weight Maximum capacity (states heavier than it are dropped)
+   * @param used_pallets Output: selected pallets
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @param stats Output: stored states and decision bits, row plus packed
+   * bits in bytes
+   * @return Maximum profit
+   * @details
+   * The answer is the largest q whose minimum weight fits. Since that weight
+   * (and count) is minimal, the result has the same profit, weight and count
+   * as DP Vector's; when several sets tie on all three, the selected pallets
+   * may differ.
+   * Time complexity: O(nP), P = sum of profits
+   * Space complexity: O(P) states + nP/8 bytes
+   */
+  unsigned int
+  dp_solve_profit_indexed(const std::vector<Pallet> &pallets,
+                          unsigned int max_weight,
+                          std::vector<Pallet> &used_pallets,
+                          SolveBudget &budget, DPRunStats &stats);
+
+  /**
+   * @brief Whether the profit axis is much shorter than the capacity axis,
+   * i.e. (P + 1) * 8 <= (W + 1), so profit indexing does far less work than
+   * a dense (i, w) table.
+   * @param pallets List of pallets
+   * @param max_weight Maximum capacity
+   * @return True if profit indexing should be used
+   */
+  static bool prefers_profit_indexing(const std::vector<Pallet> &pallets,
+                                      unsigned int max_weight);
+
+  /**
+   * @brief Subset-sum DP for instances where every profit is c x weight: a
+   * bitset of reachable loads, updated with bits |= bits << weight (64 loads
+   * per word operation, 256 with AVX2), and the first pallet reaching each
+   * load for reconstruction.
+   * @param pallets List of pallets (profits proportional to weights)
+   * @param max_weight Maximum capacity
+   * @param used_pallets Output: selected pallets
+   * @param budget Time and cancellation budget (one tick per word)
+   * @param stats Output: loads, bitset plus first pallets in bytes, ISA and
+   * heaviest load
+   * @return Maximum profit (of the heaviest reachable load)
+   * @details
+   * The heaviest load is walked back through the first pallet reaching each
+   * load. The profit is DP Vector's; when several sets reach the heaviest
+   * load, the selected pallets may differ.
+   * Time complexity: O(nW / 64)
+   * Space complexity: O(W) loads (W/8 bytes of bits + 4W bytes of pallets)
+   */
+  unsigned int dp_solve_subset_sum(const std::vector<Pallet> &pallets,
+                                   unsigned int max_weight,
+                                   std::vector<Pallet> &used_pallets,
+                                   SolveBudget &budget, DPRunStats &stats);
+
+  /**
+   * @brief Weight-class DP: pallets are grouped by weight and each class is
+   * merged into the row at once. Sorted by decreasing profit, the best t
+   * pallets of a class give a concave gain, so the max-plus convolution of
+   * the row with it has a monotone best source per residue of the weight.
+   * @param pallets List of pallets
+   * @param max_weight Maximum capacity
+   * @param key Packed draw keys to merge (draw condition), or nullptr to
+   * merge profits
+   * @param used_pallets Output: selected pallets
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @param stats Output: rows plus one count per class and cell, in bytes
+   * @return Maximum profit
+   * @details
+   * A class of equal profits merges with a sliding-window maximum in O(W);
+   * any other class with a divide-and-conquer over the monotone best source
+   * in O(W log W). Every class records how many of its pallets each cell
+   * takes, and the reconstruction takes that many of its most profitable
+   * pallets. The profit (and, with keys, weight and count) is DP Vector's;
+   * the selected pallets may differ among ties.
+   * Time complexity: O(dW log W), d = number of distinct weights
+   * Space complexity: O(dW)
+   */
+  unsigned int dp_solve_weight_classes(const std::vector<Pallet> &pallets,
+                                       unsigned int max_weight,
+                                       const PackedDrawKey *key,
+                                       std::vector<Pallet> &used_pallets,
+                                       SolveBudget &budget,
+                                       DPRunStats &stats);
+
+  /**
+   * @brief Lexicographical order without id vectors: a draw DP over packed
+   * keys, then a canonical pass that picks the smallest ids.
+   * @param pallets List of pallets
+   * @param max_weight Maximum capacity
+   * @param key Packed draw keys of the instance (must fit)
+   * @param used_pallets Output: selected pallets
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @param stats Output: rows plus two bit planes, in bytes
+   * @return Maximum profit
+   * @details
+   * The DP runs over suffixes (row i holds pallets [i, n)) and records, per
+   * cell, whether taking and whether leaving pallet i reaches the cell's
+   * best key. Every optimal set has the optimum's profit, weight and count,
+   * so the pass walks forward from (0, max_weight) and, for each position of
+   * the id sequence, takes the smallest id among the pallets an optimal set
+   * can take next. The result is the set LexPolicy keeps: its ids only get
+   * compared between entries of equal count, so appending an id keeps their
+   * order, and the id-vector DP is exact.
+   * Time complexity: O(nW + n * count)
+   * Space complexity: O(W) keys + 2 nW/8 bytes
+   */
+  unsigned int dp_solve_lex_canonical(const std::vector<Pallet> &pallets,
+                                      unsigned int max_weight,
+                                      const PackedDrawKey &key,
+                                      std::vector<Pallet> &used_pallets,
+                                      SolveBudget &budget, DPRunStats &stats);
+
+  /**
+   * @brief Whether every profit is the same multiple c of its weight (a
+   * subset-sum instance), with c as a reduced fraction.
+   * @param pallets List of pallets
+   * @param numerator Output: numerator of c
+   * @param denominator Output: denominator of c
+   * @return True if profit x denominator = weight x numerator for every
+   * pallet (false if every weight is 0)
+   */
+  static bool profit_ratio(const std::vector<Pallet> &pallets,
+                           unsigned long long &numerator,
+                           unsigned long long &denominator);
+
+  /**
+   * @brief Estimates the peak memory of each strategy for the (reduced)
+   * instance and picks the fastest one within memory_budget. Candidates,
+   * fastest first: Subset-Sum (when profit_ratio() holds, draw condition
+   * off), Profit-Indexed (when prefers_profit_indexing()), Parallel
+   * (more than one thread), Bitset, Profit-Indexed (when the profit axis is
+   * not longer than the capacity axis), Out-of-Core. Vector and Flat are
+   * never picked: they are slower than Bitset and need more memory.
+   * @param pallets List of pallets (after item fixing and weight reduction)
+   * @param max_weight Maximum capacity (after reduction)
+   * @return Chosen strategy, its estimate and a summary of the candidates
+   * @details
+   * Estimates count the tables, rolling rows and decision bits, with the
+   * entry size of the current draw/lexicographical mode. Lexicographical
+   * entries also count one id string per pallet that can fit in the truck.
+   */
+  DPPlan plan_table(const std::vector<Pallet> &pallets,
+                    unsigned int max_weight) const;
+
+  /**
+   * @brief Hirschberg-style recursion: finds the optimal split of capacity
+   * between items [lo, mid) and [mid, hi) from two rolling rows, then
+   * recurses on each half with its share of the capacity.
+   * @param pallets List of pallets
+   * @param lo First item index (inclusive)
+   * @param hi Last item index (exclusive)
+   * @param max_weight Capacity available to items [lo, hi)
+   * @param isa Instruction set for the rolling-row kernel
+   * @param used Output: indices of selected pallets, in increasing order
+   * @param budget Time and cancellation budget (one tick per cell)
+   * @tparam Cell Row entry type (16, 32 or 64 bits); must hold the sum of
+   * the profits of pallets [lo, hi)
+   * @details
+   * Only two rows of (max_weight + 1) entries are alive at any time: they are
+   * released before recursing.
+   */
+  template <class Cell>
+  void dp_divide_and_conquer(const std::vector<Pallet> &pallets,
+                             unsigned int lo, unsigned int hi,
+                             unsigned int max_weight, DPKernels::ISA isa,
+                             std::vector<unsigned int> &used,
+                             SolveBudget &budget);
 
 public:
   /**
@@ -125,19 +609,76 @@ public:
         draw_condition(draw_condition) {}
 
   /**
-   * @brief Solves the knapsack problem using DP (vector or hashmap),
+   * @brief Solves the knapsack problem using DP (vector, flat, hashmap,
+   * bit-packed decisions, optionally row-parallel, or profit-indexed),
    * reconstructs solution.
    * @param pallets List of pallets
    * @param truck Truck (capacity)
    * @param used_pallets Output: selected pallets
-   * @param type TableType::Vector or TableType::HashMap
+   * @param type TableType::Vector, TableType::HashMap, TableType::Flat,
+   * TableType::Bitset, TableType::Parallel, TableType::ProfitIndexed,
+   * TableType::IterativeHashMap, TableType::OutOfCore, TableType::Tiled,
+   * TableType::SubsetSum, TableType::WeightClass or TableType::Auto
    * @param message Output: status and timing info
    * @param timeout_ms Timeout in milliseconds
+   * @param cancel Optional token to stop the solve from another thread
    * @return Maximum profit
+   * @throws std::runtime_error for TableType::OutOfCore if the scratch file
+   * cannot be created (see set_scratch_directory())
+   * @note TableType::Auto runs the strategy chosen by plan_table() and
+   * reports it in the message. If no strategy fits the memory budget,
+   * nothing is allocated and 0 is returned.
+   * @note The dense types (Vector, Flat, Bitset, Parallel, OutOfCore, Tiled)
+   * switch to TableType::ProfitIndexed when the sum of profits is much
+   * smaller than the capacity (see set_auto_profit_indexing()). Profit
+   * indexing does not track pallet ids, so with lexicographical order
+   * TableType::ProfitIndexed runs as TableType::Bitset.
+   * @note With the draw condition only, the rolling-row types run on packed
+   * 64-bit keys when they fit (see set_packed_draw_key()).
+   * @note Without the draw condition, the dense types run as
+   * TableType::SubsetSum when every profit is c x weight, and TableType::Auto
+   * plans it first (see set_subset_sum_detection()). TableType::SubsetSum
+   * runs as TableType::Bitset on other instances and with the draw
+   * condition.
+   * @note With lexicographical order, TableType::Bitset runs
+   * dp_solve_lex_canonical() when the packed draw key fits (see
+   * set_canonical_lex()); the other types keep id vectors per cell.
+   * @note TableType::WeightClass does not track pallet ids, so with
+   * lexicographical order it runs as TableType::Bitset. It also runs as
+   * TableType::Bitset when the profit sum does not fit in an unsigned int or,
+   * with the draw condition, the packed draw key does not fit.
    */
   unsigned int dp_solve(const std::vector<Pallet> &pallets, const Truck &truck,
                         std::vector<Pallet> &used_pallets, TableType type,
-                        std::string &message, unsigned int timeout_ms);
+                        std::string &message, unsigned int timeout_ms,
+                        const CancellationToken *cancel = nullptr);
+
+  /**
+   * @brief Solves the knapsack problem for many truck capacities with one
+   * bottom-up pass: the last row holds the optimum for every capacity up to
+   * the largest one.
+   * @param pallets List of pallets
+   * @param queries Trucks to answer (capacity, and whether to reconstruct)
+   * @param sweep Output: profit and selection of every query, plus the
+   * profit curve for every capacity 0..max
+   * @param message Output: status and timing info
+   * @param timeout_ms Timeout in milliseconds
+   * @param cancel Optional token to stop the solve from another thread
+   * @return Maximum profit for the largest capacity
+   * @details
+   * Rows only hold entries up to the largest capacity, and "taken" bits up
+   * to the largest capacity that is reconstructed. Each selection is walked
+   * back from its own capacity and is the one dp_solve (TableType::Bitset)
+   * returns for that truck with item fixing off.
+   * Time complexity: O(nW + qn), W the largest capacity, q queries
+   * Space complexity: O(W) entries + nW'/8 bytes, W' the largest
+   * reconstructed capacity
+   */
+  unsigned int dp_capacity_sweep(const std::vector<Pallet> &pallets,
+                                 const std::vector<CapacityQuery> &queries,
+                                 CapacitySweep &sweep, std::string &message,
+                                 unsigned int timeout_ms,
+                                 const CancellationToken *cancel = nullptr);
 
   /**
    * @brief Solves the knapsack problem using DP optimized (2 rolling rows),
@@ -146,13 +687,94 @@ public:
    * @param truck Truck (capacity)
    * @param message Output: status and timing info
    * @param timeout_ms Timeout in milliseconds
+   * @param cancel Optional token to stop the solve from another thread
    * @return Maximum profit
    * @details
    * Time complexity: O(nW)
    * Space complexity: O(W)
    */
   unsigned int dp_solve(const std::vector<Pallet> &pallets, const Truck &truck,
-                        std::string &message, unsigned int timeout_ms);
+                        std::string &message, unsigned int timeout_ms,
+                        const CancellationToken *cancel = nullptr);
+
+  /**
+   * @brief Solves the knapsack problem using a vectorized single rolling row
+   * (AVX2, SSE4.1 or scalar, chosen at runtime), only max profit.
+   * @param pallets List of pallets
+   * @param truck Truck (capacity)
+   * @param message Output: status, timing and throughput (cells/second)
+   * @param timeout_ms Timeout in milliseconds (one tick per cell)
+   * @param cancel Optional token to stop the solve from another thread
+   * @return Maximum profit
+   * @details
+   * Time complexity: O(nW / lanes)
+   * Space complexity: O(W)
+   * @note Row cells are 16, 32 or 64 bits wide, the narrowest that holds the
+   * sum of all profits (see DPKernels::cell_bits). 16-bit cells double the
+   * lanes per vector. With 64-bit cells the profit is exact; when it exceeds
+   * the unsigned return value, the message reports it.
+   */
+  unsigned int dp_solve_simd(const std::vector<Pallet> &pallets,
+                             const Truck &truck, std::string &message,
+                             unsigned int timeout_ms,
+                             const CancellationToken *cancel = nullptr);
+
+  /**
+   * @brief Solves the knapsack problem in O(W) memory and reconstructs the
+   * selected pallets using divide and conquer (Hirschberg) over the
+   * vectorized rolling-row kernel.
+   * @param pallets List of pallets
+   * @param truck Truck (capacity)
+   * @param used_pallets Output: selected pallets
+   * @param message Output: status and timing info
+   * @param timeout_ms Timeout in milliseconds
+   * @param cancel Optional token to stop the solve from another thread
+   * @return Maximum profit
+   * @details
+   * Time complexity: O(nW log n / lanes), about 2x a single rolling-row pass
+   * in practice since the work halves at each level.
+   * Space complexity: O(W + n)
+   * @note Rows use the same adaptive cell width as dp_solve_simd().
+   * @note Maximizes profit only (no draw condition). The selected set has the
+   * same profit as DP Vector but may differ from it when several optimal sets
+   * exist.
+   */
+  unsigned int dp_solve_divide_and_conquer(const std::vector<Pallet> &pallets,
+                                           const Truck &truck,
+                                           std::vector<Pallet> &used_pallets,
+                                           std::string &message,
+                                           unsigned int timeout_ms,
+                                           const CancellationToken *cancel =
+                                               nullptr);
+
+  /**
+   * @brief Solves the knapsack problem over the Pareto frontier of reachable
+   * (weight, profit) states (Nemhauser-Ullmann) and reconstructs the
+   * selected pallets.
+   * @param pallets List of pallets
+   * @param truck Truck (capacity)
+   * @param used_pallets Output: selected pallets
+   * @param message Output: status, timing and frontier sizes
+   * @param timeout_ms Timeout in milliseconds (one tick per state merged)
+   * @param cancel Optional token to stop the solve from another thread
+   * @return Maximum profit
+   * @details
+   * After each item the frontier is the list of states, sorted by weight,
+   * where each state has strictly more profit than all lighter ones. Adding
+   * an item merges the frontier with a copy of itself shifted by the item's
+   * weight and profit (dropping states over capacity) and discards dominated
+   * states. For reconstruction, every state keeps the index of its parent in
+   * the previous frontier and whether the item was taken.
+   * Time complexity: O(sum of frontier sizes) <= O(n min(W, P))
+   * Space complexity: O(sum of frontier sizes)
+   * @note Maximizes profit; among optimal sets the chosen one has minimum
+   * weight, but it may differ from DP Vector's.
+   */
+  unsigned int dp_solve_pareto(const std::vector<Pallet> &pallets,
+                               const Truck &truck,
+                               std::vector<Pallet> &used_pallets,
+                               std::string &message, unsigned int timeout_ms,
+                               const CancellationToken *cancel = nullptr);
 
   /**
    * @brief Enable or disable lexicographical tie-breaking in DP.
@@ -165,6 +787,101 @@ public:
   void set_lexicographical_order(bool enable) {
     lexicographical_order = enable; }
    void set_draw_condition(bool enable) { draw_condition = enable; }
+
+  /**
+   * @brief Set the number of worker threads used by TableType::Parallel.
+   * @param threads Number of threads (0: use hardware concurrency)
+   */
+  void set_num_threads(unsigned int threads) { num_threads = threads; }
+
+  /**
+   * @brief Set the tile shape of TableType::Tiled.
+   * @param items Pallets applied per block (0: automatic, 8)
+   * @param width Capacity cells per tile, rounded up to 64 (0: automatic,
+   * so that the block's rows of one tile take about 256 KB)
+   */
+  void set_tiling(unsigned int items, unsigned int width) {
+    tile_items = items;
+    tile_width = width;
+  }
+
+  /**
+   * @brief Enable or disable the automatic switch of dense table types to
+   * profit indexing when the sum of profits is much smaller than the capacity.
+   * @param enable True to allow the switch (default: true)
+   */
+  void set_auto_profit_indexing(bool enable) { auto_profit_indexing = enable; }
+
+  /**
+   * @brief Enable or disable packed draw keys: with the draw condition (and
+   * no lexicographical order), TableType::Bitset, TableType::Parallel,
+   * TableType::OutOfCore and TableType::Tiled run on one 64-bit key per cell
+   * (PackedDrawKey)
+   * instead of DPEntryDraw, when the key fits. Results are identical either
+   * way.
+   * @param enable True to pack when possible (default: true)
+   */
+  void set_packed_draw_key(bool enable) { packed_draw_key = enable; }
+
+  /**
+   * @brief Enable or disable the automatic switch of dense table types and
+   * TableType::Auto to TableType::SubsetSum when every profit is the same
+   * multiple of its weight (draw condition off). The profit is identical
+   * either way.
+   * @param enable True to allow the switch (default: true)
+   */
+  void set_subset_sum_detection(bool enable) { subset_sum_detection = enable; }
+
+  /**
+   * @brief Enable or disable the canonical lexicographical pass: with
+   * lexicographical order, TableType::Bitset runs a draw DP over packed keys
+   * and picks the smallest ids afterwards, instead of copying id vectors into
+   * every cell (when the key fits). The selected pallets are identical either
+   * way.
+   * @param enable True to use the canonical pass (default: true)
+   */
+  void set_canonical_lex(bool enable) { canonical_lex = enable; }
+
+  /**
+   * @brief Enable or disable the reduction of the capacity axis applied
+   * before every DP mode (capacity capped at the total weight, then weights
+   * and capacity divided by the GCD of the weights). Results are identical
+   * either way; only table size and runtime change.
+   * @param enable True to reduce (default: true)
+   */
+  void set_weight_reduction(bool enable) { weight_reduction = enable; }
+
+  /**
+   * @brief Enable or disable item fixing (InstanceReduction) before every DP
+   * mode.
+   * @param enable True to fix pallets by bounds (default: true)
+   */
+  void set_item_fixing(bool enable) { item_fixing = enable; }
+
+  /**
+   * @brief Set the directory where TableType::OutOfCore creates its scratch
+   * file (needs about nW/8 bytes of free space; the file is removed when the
+   * solve ends).
+   * @param directory Directory path (empty: the system temporary directory)
+   */
+  void set_scratch_directory(const std::string &directory) {
+    scratch_directory = directory;
+  }
+
+  /**
+   * @brief Set the memory budget TableType::Auto plans against.
+   * @param bytes Peak bytes the DP may use (0: no limit, default)
+   */
+  void set_memory_budget(std::size_t bytes) { memory_budget = bytes; }
+
+  /**
+   * @brief Plans TableType::Auto for an instance without solving it: applies
+   * the same reductions as dp_solve(), then plan_table().
+   * @param pallets List of pallets
+   * @param truck Truck (capacity)
+   * @return Strategy dp_solve() would run, with its memory estimate
+   */
+  DPPlan plan(const std::vector<Pallet> &pallets, const Truck &truck) const;
 };
 
 #endif  // DYNAMIC_PROGRAMMING_H
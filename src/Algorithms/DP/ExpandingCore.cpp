@@ -0,0 +1,210 @@
+#include "ExpandingCore.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "../APPROX/Greedy.h"
+
+long long ExpandingCore::upper_bound(const State &state,
+                                     const std::vector<const Pallet *> &sorted,
+                                     unsigned int s, unsigned int t,
+                                     unsigned int max_weight) {
+  if (state.weight <= max_weight) {
+    if (t >= sorted.size())
+      return state.profit;
+    // Fill the free capacity at the best ratio still available on the right
+    const Pallet &next = *sorted[t];
+    unsigned long long gain = (max_weight - state.weight) *
+                              static_cast<unsigned long long>(
+                                  next.get_profit()) /
+                              next.get_weight();
+    return state.profit + static_cast<long long>(gain);
+  }
+  // Removing left pallets frees at most the break solution's weight (<= W)
+  unsigned long long excess = state.weight - max_weight;
+  if (s == 0 || excess > max_weight)
+    return -1;
+  // Free the excess at the worst ratio still available on the left
+  const Pallet &prev = *sorted[s - 1];
+  unsigned long long loss =
+      (excess * static_cast<unsigned long long>(prev.get_profit()) +
+       prev.get_weight() - 1) /
+      prev.get_weight();
+  return state.profit - static_cast<long long>(loss);
+}
+
+unsigned int ExpandingCore::core_solve(const std::vector<Pallet> &pallets,
+                                       const Truck &truck,
+                                       std::vector<Pallet> &used_pallets,
+                                       std::string &message,
+                                       unsigned int timeout_ms,
+                                       const CancellationToken *cancel) {
+  auto start_time = std::chrono::steady_clock::now();
+  SolveBudget budget(timeout_ms, cancel);
+
+  unsigned int n = pallets.size();
+  unsigned int W = truck.get_capacity();
+
+  // Ratio order (same as Greedy), kept as input positions for the output
+  std::vector<unsigned int> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](unsigned int a, unsigned int b) {
+    return Greedy::ratio_order(pallets[a], pallets[b]);
+  });
+  std::vector<const Pallet *> sorted(n);
+  for (unsigned int k = 0; k < n; ++k)
+    sorted[k] = &pallets[order[k]];
+
+  // Break solution: every pallet before the break item b
+  unsigned int b = 0;
+  State root{0, 0};
+  while (b < n && root.weight + sorted[b]->get_weight() <= W) {
+    root.weight += sorted[b]->get_weight();
+    root.profit += sorted[b]->get_profit();
+    ++b;
+  }
+
+  // Incumbent: greedy fill in ratio order (at least the break solution)
+  std::vector<char> best_taken(n, 0);
+  long long best = 0;
+  unsigned long long greedy_weight = 0;
+  for (unsigned int k = 0; k < n; ++k) {
+    if (greedy_weight + sorted[k]->get_weight() <= W) {
+      greedy_weight += sorted[k]->get_weight();
+      best += sorted[k]->get_profit();
+      best_taken[k] = 1;
+    }
+  }
+
+  // links[offsets[k] + j]: parent index (<< 1) and "changed" bit of the j-th
+  // surviving state after step k, whose core pallet is step_item[k]
+  std::vector<unsigned int> links;
+  std::vector<std::size_t> offsets;
+  std::vector<unsigned int> step_item;
+  std::vector<unsigned int> step_links;
+  std::vector<State> states, next;
+  if (upper_bound(root, sorted, b, b, W) > best)
+    states.push_back(root);
+
+  unsigned int s = b, t = b;
+  std::size_t peak = states.size();
+  bool right = true;
+  while (!states.empty() && (s > 0 || t < n)) {
+    // Each step merges the whole state list
+    if (budget.tick(states.size())) {
+      message = "[Core DP] " + budget.stop_reason();
+      used_pallets.clear();
+      return 0;
+    }
+    // Alternate sides while both have pallets left
+    bool add = (right && t < n) || s == 0;
+    right = !right;
+    unsigned int item = add ? t : s - 1;
+    unsigned long long pw = sorted[item]->get_weight();
+    long long pp = sorted[item]->get_profit();
+
+    // Merge the list with its shifted copy (both sorted by weight), keeping
+    // only states more profitable than every lighter one
+    next.clear();
+    step_links.clear();
+    std::size_t size = states.size(), a = 0, c = 0;
+    while (a < size || c < size) {
+      bool change;
+      State candidate;
+      if (c < size) {
+        State shifted = add ? State{states[c].weight + pw,
+                                    states[c].profit + pp}
+                            : State{states[c].weight - pw,
+                                    states[c].profit - pp};
+        change = a == size || shifted.weight < states[a].weight ||
+                 (shifted.weight == states[a].weight &&
+                  shifted.profit >= states[a].profit);
+        candidate = change ? shifted : states[a];
+      } else {
+        change = false;
+        candidate = states[a];
+      }
+      std::size_t parent = change ? c++ : a++;
+      if (next.empty() || candidate.profit > next.back().profit) {
+        next.push_back(candidate);
+        step_links.push_back(static_cast<unsigned int>(parent << 1) | change);
+      }
+    }
+    if (add)
+      ++t;
+    else
+      --s;
+    peak = std::max(peak, next.size());
+
+    // The heaviest fitting state is the most profitable one
+    auto fit = std::upper_bound(next.begin(), next.end(), W,
+                                [](unsigned int w, const State &state) {
+                                  return w < state.weight;
+                                });
+    if (fit != next.begin() && std::prev(fit)->profit > best) {
+      best = std::prev(fit)->profit;
+      for (unsigned int k = 0; k < n; ++k)
+        best_taken[k] = k < b;
+      // A "changed" bit flips the pallet away from the break solution
+      unsigned int link = step_links[std::prev(fit) - next.begin()];
+      if (link & 1)
+        best_taken[item] = item >= b;
+      std::size_t idx = link >> 1;
+      for (std::size_t step = step_item.size(); step-- > 0;) {
+        link = links[offsets[step] + idx];
+        if (link & 1)
+          best_taken[step_item[step]] = step_item[step] >= b;
+        idx = link >> 1;
+      }
+    }
+
+    // Keep only the states that may still beat the incumbent
+    states.clear();
+    offsets.push_back(links.size());
+    step_item.push_back(item);
+    for (std::size_t j = 0; j < next.size(); ++j) {
+      if (upper_bound(next[j], sorted, s, t, W) > best) {
+        states.push_back(next[j]);
+        links.push_back(step_links[j]);
+      }
+    }
+  }
+  bool proven = states.empty();
+
+  std::vector<unsigned int> chosen;
+  for (unsigned int k = 0; k < n; ++k)
+    if (best_taken[k])
+      chosen.push_back(order[k]);
+  std::sort(chosen.begin(), chosen.end());
+  used_pallets.clear();
+  for (unsigned int idx : chosen)
+    used_pallets.push_back(pallets[idx]);
+
+  auto end_time = std::chrono::steady_clock::now();
+  auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                      end_time - start_time)
+                      .count();
+
+  std::size_t memory = links.size() * sizeof(unsigned int) +
+                       step_item.size() *
+                           (sizeof(std::size_t) + sizeof(unsigned int)) +
+                       2 * peak * sizeof(State) +
+                       n * (sizeof(unsigned int) + sizeof(const Pallet *));
+  std::string memory_str;
+  if (memory < 1024)
+    memory_str = std::to_string(memory) + " B";
+  else if (memory < 1024 * 1024)
+    memory_str = std::to_string(memory / 1024) + " KB";
+  else
+    memory_str = std::to_string(memory / (1024 * 1024)) + " MB";
+
+  message = "[Core DP] Execution time: " + std::to_string(duration) +
+            " μs | Break item: " + std::to_string(b) + " | Core: [" +
+            std::to_string(s) + ", " + std::to_string(t) + ") (" +
+            std::to_string(t - s) + " of " + std::to_string(n) +
+            " pallets) | States: " + std::to_string(links.size()) +
+            " (peak " + std::to_string(peak) + ") | Memory used: " +
+            memory_str + " | Optimality: " +
+            (proven ? "proven by bound" : "core spans all pallets");
+  return static_cast<unsigned int>(best);
+}
@@ -0,0 +1,88 @@
+#ifndef EXPANDING_CORE_H
+#define EXPANDING_CORE_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "../../DataStructures/Pallet.h"
+#include "../../DataStructures/Truck.h"
+#include "../SolveBudget.h"
+
+/**
+ * @class ExpandingCore
+ * @brief Exact expanding-core solver (Pisinger's Minknap scheme) for the 0/1
+ * Knapsack Problem.
+ *
+ * Pallets are ordered by ratio (Greedy::ratio_order). The break item is the
+ * first pallet that no longer fits when filling in that order. An optimal
+ * solution usually differs from this break solution only for pallets close
+ * to the break item, the "core".
+ *
+ * The DP starts from the break solution (every pallet before the break item
+ * taken, none after) and grows the core one pallet at a time, alternating
+ * right (may add pallet t) and left (may remove pallet s - 1). The states
+ * are a Pareto list of (weight, profit) pairs, sorted by weight. States may
+ * temporarily exceed the capacity, since a later removal can repair them.
+ *
+ * A state is discarded once its upper bound cannot beat the incumbent:
+ * - fitting state: p + (W - w) * ratio(t), since the pallets still outside
+ *   on the right have no better ratio;
+ * - overweight state: p - (w - W) * ratio(s - 1), since the pallets on the
+ *   left have no worse ratio.
+ * The search stops when no state survives (optimality proven by the bound)
+ * or when the core covers every pallet.
+ *
+ * Time complexity: O(sum of list sizes), usually a small core even for
+ * tens of thousands of pallets; O(n min(W, P)) in the worst case.
+ * Space complexity: O(sum of list sizes) for reconstruction links.
+ */
+class ExpandingCore {
+private:
+  /**
+   * @struct State
+   * @brief One (weight, profit) configuration of the current core.
+   */
+  struct State {
+    unsigned long long weight; ///< Total weight (may exceed the capacity)
+    long long profit;          ///< Total profit
+  };
+
+  /**
+   * @brief Upper bound on the profit reachable from a state.
+   * @param state State to bound
+   * @param sorted Pallets in ratio order
+   * @param s First pallet of the core (pallets before it are taken)
+   * @param t One past the last pallet of the core (pallets from it are not
+   * taken)
+   * @param max_weight Capacity
+   * @return Upper bound, or -1 if the state can never fit
+   */
+  static long long upper_bound(const State &state,
+                               const std::vector<const Pallet *> &sorted,
+                               unsigned int s, unsigned int t,
+                               unsigned int max_weight);
+
+public:
+  /**
+   * @brief Solves the knapsack problem exactly by expanding a core around the
+   * break item.
+   * @param pallets List of pallets
+   * @param truck Truck (capacity)
+   * @param used_pallets Output: selected pallets, in input order
+   * @param message Output: status, timing, final core and state counts
+   * @param timeout_ms Timeout in milliseconds (one tick per state merged)
+   * @param cancel Optional token to stop the solve from another thread
+   * @return Maximum profit
+   * @details
+   * Time complexity: O(n log n) sort + O(sum of list sizes)
+   * Space complexity: O(n + sum of list sizes)
+   */
+  unsigned int core_solve(const std::vector<Pallet> &pallets,
+                          const Truck &truck,
+                          std::vector<Pallet> &used_pallets,
+                          std::string &message, unsigned int timeout_ms,
+                          const CancellationToken *cancel = nullptr);
+};
+
+#endif // EXPANDING_CORE_H
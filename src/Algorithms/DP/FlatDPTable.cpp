@@ -0,0 +1,28 @@
+#include "FlatDPTable.h"
+#include <cstdlib>
+#include <new>
+
+template <class Entry>
+FlatDPTable<Entry>::FlatDPTable(unsigned int n, unsigned int max_weight)
+    : rows(static_cast<std::size_t>(n) + 1),
+      cols(static_cast<std::size_t>(max_weight) + 1) {
+  std::size_t bytes = rows * cols * sizeof(Entry);
+  // std::aligned_alloc requires the size to be a multiple of the alignment
+  allocated_bytes = (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+  void *buffer = std::aligned_alloc(ALIGNMENT, allocated_bytes);
+  if (!buffer)
+    throw std::bad_alloc();
+  cells = static_cast<Entry *>(buffer);
+  for (std::size_t k = 0; k < rows * cols; ++k)
+    new (cells + k) Entry();
+}
+
+template <class Entry> FlatDPTable<Entry>::~FlatDPTable() {
+  for (std::size_t k = 0; k < rows * cols; ++k)
+    cells[k].~Entry();
+  std::free(cells);
+}
+
+template class FlatDPTable<DPSimpleEntry>;
+template class FlatDPTable<DPEntryDraw>;
+template class FlatDPTable<DPEntryLex>;
@@ -0,0 +1,107 @@
+#ifndef FLAT_DPTABLE_H
+#define FLAT_DPTABLE_H
+
+#include "DPEntry.h"
+#include "DPTable.h"
+#include <cstddef>
+#include <memory>
+
+/**
+ * @class FlatDPTable
+ * @brief Concrete DP table implementation storing entries by value in one
+ * contiguous, cache-line aligned, row-major buffer for bottom-up DP.
+ *
+ * Unlike VectorDPTable, no per-cell heap allocation is performed: the whole
+ * (n + 1) x (max_weight + 1) table is a single allocation, and cell (i, w)
+ * lives at offset i * (max_weight + 1) + w.
+ *
+ * Templated on the DP entry type (DPSimpleEntry, DPEntryDraw, DPEntryLex).
+ * Explicit instantiations are provided for these three types.
+ */
+template <class Entry> class FlatDPTable final : public DPTable {
+private:
+  static constexpr std::size_t ALIGNMENT = 64; ///< Cache line size in bytes
+
+  Entry *cells = nullptr;        ///< Row-major buffer of (n + 1) * cols cells
+  std::size_t rows = 0;          ///< Number of rows (n + 1)
+  std::size_t cols = 0;          ///< Number of columns (max_weight + 1)
+  std::size_t allocated_bytes = 0; ///< Bytes actually allocated for the buffer
+
+public:
+  /**
+   * @brief Construct a new FlatDPTable object with every cell set to the empty
+   * entry.
+   * @param n Number of items
+   * @param max_weight Maximum capacity
+   * @throws std::bad_alloc if the buffer cannot be allocated
+   */
+  FlatDPTable(unsigned int n, unsigned int max_weight);
+
+  FlatDPTable(const FlatDPTable &) = delete;
+  FlatDPTable &operator=(const FlatDPTable &) = delete;
+
+  /**
+   * @brief Destroy the FlatDPTable object and release its buffer.
+   */
+  ~FlatDPTable() override;
+
+  /**
+   * @brief Typed, non-virtual access to the entry at (i, w).
+   * @param i Index for the item
+   * @param w Index for the weight
+   * @return const Entry& Reference to the DP entry
+   */
+  const Entry &at(unsigned int i, unsigned int w) const {
+    return cells[i * cols + w];
+  }
+
+  /**
+   * @brief Typed, non-virtual store of the entry at (i, w) (no allocation).
+   * @param i Index for the item
+   * @param w Index for the weight
+   * @param entry Entry to copy into the cell
+   */
+  void put(unsigned int i, unsigned int w, const Entry &entry) {
+    cells[i * cols + w] = entry;
+  }
+
+  /**
+   * @brief Get a const reference to the DP entry at the specified indices.
+   * @param i Index for the item
+   * @param w Index for the weight
+   * @return const DPEntryBase& Reference to the DP entry
+   */
+  const DPEntryBase &get(unsigned int i, unsigned int w) const override {
+    return at(i, w);
+  }
+
+  /**
+   * @brief Set the DP entry at the specified indices (copied by value).
+   * @param i Index for the item
+   * @param w Index for the weight
+   * @param entry Unique pointer to the DP entry (must hold an Entry)
+   */
+  void set(unsigned int i, unsigned int w,
+           std::unique_ptr<DPEntryBase> entry) override {
+    put(i, w, static_cast<const Entry &>(*entry));
+  }
+
+  /**
+   * @brief Get the total number of entries in the DP table.
+   * @return std::size_t Total number of entries
+   */
+  std::size_t get_num_entries() const override { return rows * cols; }
+
+  /**
+   * @brief Get the number of bytes allocated for the table buffer.
+   * @return std::size_t Memory usage in bytes
+   * @note For DPEntryLex, the heap storage of the id vectors is not included.
+   */
+  std::size_t get_memory_usage() const override { return allocated_bytes; }
+};
+
+extern template class FlatDPTable<DPSimpleEntry>;
+extern template class FlatDPTable<DPEntryDraw>;
+extern template class FlatDPTable<DPEntryLex>;
+
+#endif // FLAT_DPTABLE_H
@@ -0,0 +1,65 @@
+#include "OpenAddressingDPTable.h"
+
+#include <utility>
+
+template <class Entry>
+OpenAddressingDPTable<Entry>::OpenAddressingDPTable(std::size_t expected)
+    : missing(Entry::NOT_COMPUTED) {
+  rehash(MIN_CAPACITY);
+  reserve(expected);
+}
+
+template <class Entry>
+void OpenAddressingDPTable<Entry>::rehash(std::size_t capacity) {
+  std::vector<Slot> old(capacity);
+  old.swap(slots);
+  mask = capacity - 1;
+  shift = 64;
+  for (std::size_t c = capacity; c > 1; c >>= 1)
+    shift--;
+  for (Slot &slot : old) {
+    if (slot.key == EMPTY_KEY)
+      continue;
+    std::size_t s = home(slot.key);
+    while (slots[s].key != EMPTY_KEY)
+      s = (s + 1) & mask;
+    slots[s].key = slot.key;
+    slots[s].entry = std::move(slot.entry);
+  }
+}
+
+template <class Entry>
+void OpenAddressingDPTable<Entry>::reserve(std::size_t count) {
+  std::size_t capacity = slots.size();
+  // Keep the load factor at or below 3/4
+  while (count > capacity / 4 * 3)
+    capacity *= 2;
+  if (capacity != slots.size())
+    rehash(capacity);
+}
+
+template <class Entry>
+void OpenAddressingDPTable<Entry>::put(unsigned int i, unsigned int w,
+                                       Entry entry) {
+  std::uint64_t k = key(i, w);
+  std::size_t s = home(k);
+  while (slots[s].key != EMPTY_KEY && slots[s].key != k)
+    s = (s + 1) & mask;
+  if (slots[s].key == k) {
+    slots[s].entry = std::move(entry);
+    return;
+  }
+  if (size + 1 > slots.size() / 4 * 3) {
+    reserve(size + 1);
+    s = home(k);
+    while (slots[s].key != EMPTY_KEY)
+      s = (s + 1) & mask;
+  }
+  slots[s].key = k;
+  slots[s].entry = std::move(entry);
+  size++;
+}
+
+template class OpenAddressingDPTable<DPSimpleEntry>;
+template class OpenAddressingDPTable<DPEntryDraw>;
+template class OpenAddressingDPTable<DPEntryLex>;
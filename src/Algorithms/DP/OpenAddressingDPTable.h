@@ -0,0 +1,156 @@
+#ifndef OPEN_ADDRESSING_DPTABLE_H
+#define OPEN_ADDRESSING_DPTABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "DPEntry.h"
+#include "DPTable.h"
+
+/**
+ * @class OpenAddressingDPTable
+ * @brief Concrete sparse DP table for the memoized (top-down) DP: open
+ * addressing with linear probing over one flat array of slots.
+ *
+ * Each slot holds a packed key (i << 32) | w and the entry by value, so a
+ * lookup touches one contiguous run of slots and nothing is allocated per
+ * state. The capacity is a power of two and doubles when the load factor
+ * would exceed 3/4. A miss returns the entry type's NOT_COMPUTED sentinel,
+ * resolved once at construction.
+ *
+ * Templated on the DP entry type (DPSimpleEntry, DPEntryDraw, DPEntryLex).
+ * Explicit instantiations are provided for these three types.
+ *
+ * @warning Storing a new state may move every slot: references and pointers
+ * returned by at()/find() are only valid until the next put().
+ */
+template <class Entry> class OpenAddressingDPTable final : public DPTable {
+private:
+  /// Key of a slot that holds no state ((i, w) never packs to this)
+  static constexpr std::uint64_t EMPTY_KEY = ~std::uint64_t(0);
+  static constexpr std::size_t MIN_CAPACITY = 16;
+
+  /**
+   * @struct Slot
+   * @brief One cell of the probe array.
+   */
+  struct Slot {
+    std::uint64_t key = EMPTY_KEY; ///< Packed (i, w), or EMPTY_KEY
+    Entry entry;                   ///< Stored entry (valid if key is set)
+  };
+
+  std::vector<Slot> slots; ///< Probe array, size is a power of two
+  std::size_t mask = 0;    ///< slots.size() - 1
+  unsigned int shift = 0;  ///< 64 - log2(slots.size()), for hashing
+  std::size_t size = 0;    ///< Number of stored states
+  const Entry &missing;    ///< Sentinel returned by at() for unknown states
+
+  static std::uint64_t key(unsigned int i, unsigned int w) {
+    return (static_cast<std::uint64_t>(i) << 32) | w;
+  }
+
+  // Fibonacci hashing: the top bits of key * 2^64 / phi
+  std::size_t home(std::uint64_t k) const {
+    return static_cast<std::size_t>((k * 0x9E3779B97F4A7C15ULL) >> shift);
+  }
+
+  /**
+   * @brief Reallocates the probe array and reinserts every state.
+   * @param capacity New number of slots (power of two)
+   */
+  void rehash(std::size_t capacity);
+
+public:
+  /**
+   * @brief Construct a new OpenAddressingDPTable object.
+   * @param expected Number of states to hold without growing (0: minimum)
+   */
+  explicit OpenAddressingDPTable(std::size_t expected = 0);
+
+  /**
+   * @brief Typed, non-virtual lookup of the state (i, w).
+   * @param i Item index
+   * @param w Remaining capacity
+   * @return Pointer to the entry, or nullptr if the state is not stored
+   */
+  const Entry *find(unsigned int i, unsigned int w) const {
+    std::uint64_t k = key(i, w);
+    for (std::size_t s = home(k);; s = (s + 1) & mask) {
+      if (slots[s].key == k)
+        return &slots[s].entry;
+      if (slots[s].key == EMPTY_KEY)
+        return nullptr;
+    }
+  }
+
+  /**
+   * @brief Typed, non-virtual access to the state (i, w).
+   * @param i Item index
+   * @param w Remaining capacity
+   * @return Stored entry, or Entry::NOT_COMPUTED if the state is not stored
+   */
+  const Entry &at(unsigned int i, unsigned int w) const {
+    const Entry *entry = find(i, w);
+    return entry ? *entry : missing;
+  }
+
+  /**
+   * @brief Typed, non-virtual store of the state (i, w) (inserts or
+   * overwrites; no allocation unless the table grows).
+   * @param i Item index
+   * @param w Remaining capacity
+   * @param entry Entry to move into the slot
+   */
+  void put(unsigned int i, unsigned int w, Entry entry);
+
+  /**
+   * @brief Grows the probe array so that `count` states fit without
+   * rehashing.
+   * @param count Expected number of states
+   */
+  void reserve(std::size_t count);
+
+  /**
+   * @brief Get the value stored for subproblem (i, w).
+   * @param i Item index
+   * @param w Remaining capacity
+   * @return Value for subproblem (i, w), or Entry::NOT_COMPUTED if not set
+   */
+  const DPEntryBase &get(unsigned int i, unsigned int w) const override {
+    return at(i, w);
+  }
+
+  /**
+   * @brief Set the value for subproblem (i, w) (copied by value).
+   * @param i Item index
+   * @param w Remaining capacity
+   * @param entry Unique pointer to the DP entry (must hold an Entry)
+   */
+  void set(unsigned int i, unsigned int w,
+           std::unique_ptr<DPEntryBase> entry) override {
+    put(i, w, static_cast<const Entry &>(*entry));
+  }
+
+  /**
+   * @brief Get the number of states stored in the table.
+   * @return Number of entries
+   */
+  std::size_t get_num_entries() const override { return size; }
+
+  /**
+   * @brief Get the number of bytes allocated for the probe array.
+   * @return Memory usage in bytes (every slot, used or not)
+   * @note For DPEntryLex, the heap storage of the id vectors is not included.
+   */
+  std::size_t get_memory_usage() const override {
+    return slots.capacity() * sizeof(Slot);
+  }
+};
+
+extern template class OpenAddressingDPTable<DPSimpleEntry>;
+extern template class OpenAddressingDPTable<DPEntryDraw>;
+extern template class OpenAddressingDPTable<DPEntryLex>;
+
+#endif // OPEN_ADDRESSING_DPTABLE_H
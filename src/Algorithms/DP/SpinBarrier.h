@@ -0,0 +1,46 @@
+#ifndef SPIN_BARRIER_H
+#define SPIN_BARRIER_H
+
+#include <atomic>
+#include <thread>
+
+/**
+ * @class SpinBarrier
+ * @brief Lightweight reusable barrier for a fixed group of threads.
+ *
+ * Threads spin on a generation counter for a short while and then yield, so
+ * the per-row synchronization of the parallel DP costs far less than a
+ * mutex/condition variable round trip while cores are otherwise idle.
+ */
+class SpinBarrier {
+private:
+  const unsigned int count;                  ///< Number of participants
+  std::atomic<unsigned int> waiting{0};      ///< Threads arrived so far
+  std::atomic<unsigned int> generation{0};   ///< Completed barrier phases
+
+public:
+  /**
+   * @brief Construct a new SpinBarrier object.
+   * @param count Number of threads that must arrive before any is released
+   */
+  explicit SpinBarrier(unsigned int count) : count(count) {}
+
+  /**
+   * @brief Blocks until all participants of the current phase have arrived.
+   */
+  void arrive_and_wait() {
+    unsigned int gen = generation.load(std::memory_order_acquire);
+    if (waiting.fetch_add(1, std::memory_order_acq_rel) + 1 == count) {
+      waiting.store(0, std::memory_order_relaxed);
+      generation.fetch_add(1, std::memory_order_release);
+      return;
+    }
+    unsigned int spins = 0;
+    while (generation.load(std::memory_order_acquire) == gen) {
+      if (++spins > 1024)
+        std::this_thread::yield();
+    }
+  }
+};
+
+#endif // SPIN_BARRIER_H
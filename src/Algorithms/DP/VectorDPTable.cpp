@@ -14,15 +14,13 @@ VectorDPTable::VectorDPTable(
   if (this->entry_factory) {
     auto probe = this->entry_factory();
     if (dynamic_cast<DPSimpleEntry *>(probe.get()))
-      entry_size = sizeof(unsigned int);
+      entry_size = sizeof(DPSimpleEntry);
     else if (dynamic_cast<DPEntryDraw *>(probe.get()))
-      entry_size = 3 * sizeof(unsigned int);
+      entry_size = sizeof(DPEntryDraw);
     else if (dynamic_cast<DPEntryLex *>(probe.get()))
-      entry_size = 3 * sizeof(unsigned int) + sizeof(std::vector<std::string>);
+      entry_size = sizeof(DPEntryLex);
     else
-      entry_size = sizeof(std::unique_ptr<DPEntryBase>);
-  } else {
-    entry_size = sizeof(std::unique_ptr<DPEntryBase>);
+      entry_size = 0;
   }
   table.resize(n + 1);
   for (auto &row : table) {
@@ -62,6 +60,8 @@ std::size_t VectorDPTable::get_num_entries() const {
 }
 
 std::size_t VectorDPTable::get_memory_usage() const {
+  // Each cell: owning pointer slot + separately heap-allocated entry object
   std::size_t count = get_num_entries();
-  return count * entry_size;
+  return table.size() * sizeof(std::vector<std::unique_ptr<DPEntryBase>>) +
+         count * (sizeof(std::unique_ptr<DPEntryBase>) + entry_size);
 }
@@ -18,7 +18,7 @@ private:
       table; ///< 2D vector to store DP entries
   std::function<std::unique_ptr<DPEntryBase>()>
       entry_factory;          ///< Factory function for creating DP entries
-  std::size_t entry_size = 0; ///< Size of the DP entry type
+  std::size_t entry_size = 0; ///< Size of one heap-allocated DP entry object
 
 public:
   /**
@@ -54,7 +54,8 @@ public:
   std::size_t get_num_entries() const override;
 
   /**
-   * @brief Get the total memory usage of the DP table.
+   * @brief Get the total memory usage of the DP table (row vectors, pointer
+   * slots and heap-allocated entries, excluding allocator overhead).
    * @return std::size_t Total memory usage in bytes
    */
   std::size_t get_memory_usage() const override;
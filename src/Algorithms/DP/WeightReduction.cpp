@@ -0,0 +1,50 @@
+#include "WeightReduction.h"
+
+#include <algorithm>
+#include <numeric>
+
+WeightReduction::WeightReduction(const std::vector<Pallet> &pallets,
+                                 unsigned int capacity, bool enabled)
+    : original(pallets), original_capacity(capacity), capacity(capacity) {
+  if (!enabled || pallets.empty())
+    return;
+  unsigned long long total_weight = 0;
+  unsigned int gcd = 0;
+  for (const Pallet &p : pallets) {
+    total_weight += p.get_weight();
+    gcd = std::gcd(gcd, p.get_weight());
+  }
+  // Capacities beyond the total weight add no new states
+  if (total_weight < this->capacity)
+    this->capacity = static_cast<unsigned int>(total_weight);
+  if (gcd <= 1)
+    return;
+  divisor = gcd;
+  this->capacity /= divisor;
+  reduced.reserve(pallets.size());
+  for (const Pallet &p : pallets)
+    reduced.emplace_back(p.get_id(), p.get_weight() / divisor,
+                         p.get_profit());
+}
+
+void WeightReduction::restore(std::vector<Pallet> &used_pallets) const {
+  if (divisor == 1)
+    return;
+  // Both lists follow the input order, so one forward scan matches them
+  std::size_t j = 0;
+  for (Pallet &used : used_pallets) {
+    while (j < original.size() && original[j].get_id() != used.get_id())
+      j++;
+    if (j == original.size())
+      break;
+    used = original[j++];
+  }
+}
+
+std::string WeightReduction::describe() const {
+  if (divisor == 1 && capacity == original_capacity)
+    return "";
+  return " | Weight reduction: GCD " + std::to_string(divisor) +
+         ", capacity " + std::to_string(original_capacity) + " -> " +
+         std::to_string(capacity);
+}
@@ -0,0 +1,78 @@
+#ifndef WEIGHT_REDUCTION_H
+#define WEIGHT_REDUCTION_H
+
+#include <string>
+#include <vector>
+
+#include "../../DataStructures/Pallet.h"
+
+/**
+ * @class WeightReduction
+ * @brief Shrinks the capacity axis of a DP instance without changing its
+ * solutions: the capacity is capped at the total pallet weight, then all
+ * weights and the capacity are divided by the GCD of the weights (capacity
+ * rounded down).
+ *
+ * Every reachable total weight is a multiple of the GCD, so cell (i, w) of
+ * the original table equals cell (i, w / GCD) of the reduced one, and all
+ * capacities at or above the total weight hold the same entries. The DP
+ * therefore makes the same decisions and returns the same profit and the
+ * same pallets, on a table smaller by the reduction factor.
+ */
+class WeightReduction {
+private:
+  const std::vector<Pallet> &original; ///< Pallets as given by the caller
+  std::vector<Pallet> reduced;         ///< Scaled copies (only if divisor > 1)
+  unsigned int original_capacity = 0; ///< Capacity as given by the caller
+  unsigned int capacity = 0;          ///< Reduced capacity
+  unsigned int divisor = 1;           ///< GCD of all weights
+
+public:
+  /**
+   * @brief Construct a new WeightReduction object.
+   * @param pallets List of pallets (must outlive this object)
+   * @param capacity Truck capacity
+   * @param enabled If false, pallets and capacity are passed through as is
+   * @details
+   * Time complexity: O(n)
+   * Space complexity: O(n), only when the divisor is greater than 1
+   */
+  WeightReduction(const std::vector<Pallet> &pallets, unsigned int capacity,
+                  bool enabled = true);
+
+  /**
+   * @brief Get the pallets the DP should run on.
+   * @return Reduced pallets, or the original ones if the divisor is 1
+   */
+  const std::vector<Pallet> &get_pallets() const {
+    return divisor > 1 ? reduced : original;
+  }
+
+  /**
+   * @brief Get the capacity the DP should run on.
+   * @return Reduced capacity
+   */
+  unsigned int get_capacity() const { return capacity; }
+
+  /**
+   * @brief Get the GCD all weights were divided by.
+   * @return Divisor (1 if weights were not scaled)
+   */
+  unsigned int get_divisor() const { return divisor; }
+
+  /**
+   * @brief Replaces the selected (reduced) pallets by the original ones.
+   * @param used_pallets Selected pallets, in the order of the input list
+   * @details
+   * Time complexity: O(n)
+   */
+  void restore(std::vector<Pallet> &used_pallets) const;
+
+  /**
+   * @brief Describes the reduction for result messages.
+   * @return " | Weight reduction: ..." or an empty string if nothing changed
+   */
+  std::string describe() const;
+};
+
+#endif // WEIGHT_REDUCTION_H
@@ -6,8 +6,15 @@ unsigned int ILPBridgePy::solve_ilp_py(const std::vector<Pallet> &pallets,
                                        const Truck &truck,
                                        std::vector<Pallet> &used_pallets,
                                        std::string &message,
-                                       unsigned int timeout_ms) {
+                                       unsigned int timeout_ms,
+                                       const CancellationToken *cancel) {
   auto start_time = std::chrono::high_resolution_clock::now();
+  SolveBudget budget(timeout_ms, cancel);
+  if (budget.poll()) {
+    used_pallets.clear();
+    message = "[ILP (PY)] " + budget.stop_reason();
+    return 0;
+  }
 
   // Construct paths using PROJECT_DIR
   std::string tmp_dir = Utils::get_absolute_dir("/src/Algorithms/ILP/tmp");
@@ -35,6 +42,11 @@ unsigned int ILPBridgePy::solve_ilp_py(const std::vector<Pallet> &pallets,
                         output_path + " " + std::to_string(timeout_ms) +
                         " 2> " + error_log_path;
   int ret = std::system(command.c_str());
+  if (cancel != nullptr && cancel->is_cancelled()) {
+    used_pallets.clear();
+    message = "[ILP (PY)] Cancelled.";
+    return 0;
+  }
   if (ret != 0) {
     std::ifstream error_log(error_log_path);
     std::string error_message((std::istreambuf_iterator<char>(error_log)),
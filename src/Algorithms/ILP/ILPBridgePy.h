@@ -12,6 +12,7 @@
 #include "../../DataStructures/Pallet.h"
 #include "../../DataStructures/Truck.h"
 #include "../../Utils.h"
+#include "../SolveBudget.h"
 
 /*
 
@@ -46,6 +47,7 @@ class ILPBridgePy {
     * @param used_pallets Output: selected pallets
     * @param message Output: status and timing info
     * @param timeout_ms Timeout in milliseconds
+    * @param cancel Optional token, honored before and after the Python run
     * @return Maximum profit
     * @details
     * Time complexity: Exponential in the worst case (depends on solver and
@@ -54,7 +56,8 @@ class ILPBridgePy {
    unsigned int solve_ilp_py(const std::vector<Pallet> &pallets,
                              const Truck &truck,
                              std::vector<Pallet> &used_pallets,
-                             std::string &message, unsigned int timeout_ms);
+                             std::string &message, unsigned int timeout_ms,
+                             const CancellationToken *cancel = nullptr);
 };
 
 #endif  // ILPBRIDGEPY_H
@@ -1,13 +1,18 @@
 #include "IntegerLinearProgramming.h"
 #include "absl/time/time.h"
 
+#include "../REDUCTION/InstanceReduction.h"
+
 unsigned int IntegerLinearProgramming::solve_ilp_cpp(
     const std::vector<Pallet> &pallets, const Truck &truck,
     std::vector<Pallet> &used_pallets, std::string &message,
-    unsigned int timeout_ms) {
+    unsigned int timeout_ms, const CancellationToken *cancel) {
   auto start_time = std::chrono::high_resolution_clock::now();
-  unsigned int n = pallets.size();
-  unsigned int max_weight = truck.get_capacity();
+  SolveBudget budget(timeout_ms, cancel);
+  InstanceReduction reduction(pallets, truck.get_capacity());
+  const std::vector<Pallet> &items = reduction.get_pallets();
+  unsigned int n = items.size();
+  unsigned int max_weight = reduction.get_capacity();
   unsigned int result = 0;
 
   operations_research::MPSolver solver(
@@ -28,21 +33,31 @@ unsigned int IntegerLinearProgramming::solve_ilp_cpp(
       solver.MakeRowConstraint(0.0, static_cast<double>(max_weight));
   for (unsigned int i = 0; i < n; ++i) {
     weight_constraint->SetCoefficient(
-        x[i], static_cast<double>(pallets[i].get_weight()));
+        x[i], static_cast<double>(items[i].get_weight()));
   }
 
   // objective: maximize total profit
   operations_research::MPObjective *objective = solver.MutableObjective();
   for (unsigned int i = 0; i < n; ++i) {
     objective->SetCoefficient(x[i],
-                              static_cast<double>(pallets[i].get_profit()));
+                              static_cast<double>(items[i].get_profit()));
   }
   objective->SetMaximization();
 
+  // CBC runs to its own time limit: cancellation is honored before and after
+  used_pallets.clear();
+  if (budget.poll()) {
+    message = "[ILP (CPP)] " + budget.stop_reason();
+    return 0;
+  }
+
   // solve
   const operations_research::MPSolver::ResultStatus status = solver.Solve();
 
-  used_pallets.clear();
+  if (cancel != nullptr && cancel->is_cancelled()) {
+    message = "[ILP (CPP)] Cancelled.";
+    return 0;
+  }
   if (status == operations_research::MPSolver::ABNORMAL ||
       status == operations_research::MPSolver::NOT_SOLVED) {
     message =
@@ -57,16 +72,19 @@ unsigned int IntegerLinearProgramming::solve_ilp_cpp(
 
   for (unsigned int i = 0; i < n; ++i) {
     if (x[i]->solution_value() > 0.5) {
-      used_pallets.push_back(pallets[i]);
-      result += pallets[i].get_profit();
+      used_pallets.push_back(items[i]);
+      result += items[i].get_profit();
     }
   }
+  reduction.restore(used_pallets);
+  result += reduction.get_fixed_profit();
 
   auto end_time = std::chrono::high_resolution_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
                       end_time - start_time)
                       .count();
 
-  message = "[ILP (CPP)] Execution time: " + std::to_string(duration) + " μs";
+  message = "[ILP (CPP)] Execution time: " + std::to_string(duration) +
+            " μs" + reduction.describe();
   return result;
 }
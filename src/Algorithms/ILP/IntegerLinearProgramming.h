@@ -8,6 +8,7 @@
 
 #include "../../DataStructures/Pallet.h"
 #include "../../DataStructures/Truck.h"
+#include "../SolveBudget.h"
 
 /**
  * @class IntegerLinearProgramming
@@ -30,6 +31,7 @@ class IntegerLinearProgramming {
     * @param used_pallets Output: selected pallets
     * @param message Output: status and timing info
     * @param timeout_ms Timeout in milliseconds
+    * @param cancel Optional token, honored before and after the CBC solve
     * @return Maximum profit
     * @details
     * Time complexity: Exponential in the worst case (depends on solver and
@@ -38,7 +40,8 @@ class IntegerLinearProgramming {
    unsigned int solve_ilp_cpp(const std::vector<Pallet> &pallets,
                               const Truck &truck,
                               std::vector<Pallet> &used_pallets,
-                              std::string &message, unsigned int timeout_ms);
+                              std::string &message, unsigned int timeout_ms,
+                              const CancellationToken *cancel = nullptr);
 };
 
 #endif  // INTEGER_LINEAR_PROGRAMMING_H
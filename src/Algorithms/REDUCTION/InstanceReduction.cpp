@@ -0,0 +1,166 @@
+#include "InstanceReduction.h"
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+#include "../APPROX/Greedy.h"
+
+namespace {
+// Candidate pallets in ratio order, with prefix sums for Dantzig bounds
+struct RatioPrefix {
+  std::vector<unsigned int> order;         ///< Input positions, ratio order
+  std::vector<unsigned long long> weights; ///< Prefix sums of weights
+  std::vector<unsigned long long> profits; ///< Prefix sums of profits
+
+  // LP bound of every candidate except the k-th one, for a given capacity
+  unsigned long long bound_without(const std::vector<Pallet> &pallets,
+                                   std::size_t k,
+                                   unsigned long long capacity) const {
+    std::size_t n = order.size();
+    unsigned long long wk = pallets[order[k]].get_weight();
+    unsigned long long pk = pallets[order[k]].get_profit();
+    auto fill_weight = [&](std::size_t m) {
+      return weights[m] - (m > k ? wk : 0);
+    };
+    // Largest m such that candidates [0, m) except k fit
+    std::size_t lo = 0, hi = n;
+    while (lo < hi) {
+      std::size_t mid = (lo + hi + 1) / 2;
+      if (fill_weight(mid) <= capacity)
+        lo = mid;
+      else
+        hi = mid - 1;
+    }
+    unsigned long long bound = profits[lo] - (lo > k ? pk : 0);
+    std::size_t next = lo == k ? lo + 1 : lo;
+    if (next < n) {
+      const Pallet &p = pallets[order[next]];
+      bound += (capacity - fill_weight(lo)) *
+               static_cast<unsigned long long>(p.get_profit()) /
+               p.get_weight();
+    }
+    return bound;
+  }
+};
+} // namespace
+
+InstanceReduction::InstanceReduction(const std::vector<Pallet> &pallets,
+                                     unsigned int capacity, bool fix_in,
+                                     bool enabled)
+    : original(pallets), original_capacity(capacity), capacity(capacity) {
+  if (!enabled || pallets.empty())
+    return;
+  unsigned int n = pallets.size();
+  // 0: free, 1: fixed in, 2: fixed out
+  std::vector<char> state(n, 0);
+
+  RatioPrefix sorted;
+  unsigned long long total_weight = 0;
+  for (unsigned int i = 0; i < n; ++i) {
+    if (pallets[i].get_weight() > capacity) {
+      state[i] = 2;
+      num_too_heavy++;
+    } else {
+      sorted.order.push_back(i);
+      total_weight += pallets[i].get_weight();
+    }
+  }
+
+  if (total_weight <= capacity) {
+    // Every remaining pallet fits: those with a profit are in every optimal
+    // solution. Zero-profit pallets are left to the solver's tie-break;
+    // without them the optimum is unique, so even fix_in = false takes all.
+    bool unique = std::all_of(
+        sorted.order.begin(), sorted.order.end(),
+        [&](unsigned int i) { return pallets[i].get_profit() > 0; });
+    if (fix_in || unique)
+      for (unsigned int i : sorted.order)
+        if (pallets[i].get_profit() > 0)
+          state[i] = 1;
+  } else {
+    std::sort(sorted.order.begin(), sorted.order.end(),
+              [&](unsigned int a, unsigned int b) {
+                return Greedy::ratio_order(pallets[a], pallets[b]);
+              });
+    std::size_t m = sorted.order.size();
+    sorted.weights.assign(m + 1, 0);
+    sorted.profits.assign(m + 1, 0);
+    unsigned long long greedy_weight = 0, lower_bound = 0, best_single = 0;
+    for (std::size_t k = 0; k < m; ++k) {
+      const Pallet &p = pallets[sorted.order[k]];
+      sorted.weights[k + 1] = sorted.weights[k] + p.get_weight();
+      sorted.profits[k + 1] = sorted.profits[k] + p.get_profit();
+      if (greedy_weight + p.get_weight() <= capacity) {
+        greedy_weight += p.get_weight();
+        lower_bound += p.get_profit();
+      }
+      best_single =
+          std::max(best_single, static_cast<unsigned long long>(p.get_profit()));
+    }
+    lower_bound = std::max(lower_bound, best_single);
+
+    for (std::size_t k = 0; k < m; ++k) {
+      const Pallet &p = pallets[sorted.order[k]];
+      if (fix_in && sorted.bound_without(pallets, k, capacity) < lower_bound)
+        state[sorted.order[k]] = 1;
+      else if (p.get_profit() + sorted.bound_without(
+                                    pallets, k, capacity - p.get_weight()) <
+               lower_bound)
+        state[sorted.order[k]] = 2;
+    }
+  }
+
+  unsigned long long fixed_weight = 0;
+  for (unsigned int i = 0; i < n; ++i) {
+    if (state[i] == 1) {
+      fixed_in.push_back(i);
+      fixed_weight += pallets[i].get_weight();
+      fixed_profit += pallets[i].get_profit();
+    } else if (state[i] == 2) {
+      num_fixed_out++;
+    } else {
+      residual.push_back(pallets[i]);
+    }
+  }
+  reduced = !fixed_in.empty() || num_fixed_out > 0;
+  this->capacity = static_cast<unsigned int>(capacity - fixed_weight);
+}
+
+void InstanceReduction::restore(std::vector<Pallet> &used_pallets) const {
+  if (!reduced)
+    return;
+  // Input positions of the residual pallets, by id (duplicates in order)
+  std::unordered_map<std::string, std::vector<unsigned int>> positions;
+  for (unsigned int i = original.size(); i-- > 0;)
+    positions[original[i].get_id()].push_back(i);
+  std::vector<unsigned int> chosen = fixed_in;
+  for (const Pallet &p : used_pallets) {
+    std::vector<unsigned int> &candidates = positions[p.get_id()];
+    // Skip fixed-in copies of the same id
+    while (!candidates.empty() &&
+           std::binary_search(fixed_in.begin(), fixed_in.end(),
+                              candidates.back()))
+      candidates.pop_back();
+    if (candidates.empty())
+      continue;
+    chosen.push_back(candidates.back());
+    candidates.pop_back();
+  }
+  std::sort(chosen.begin(), chosen.end());
+  used_pallets.clear();
+  for (unsigned int i : chosen)
+    used_pallets.push_back(original[i]);
+}
+
+std::string InstanceReduction::describe() const {
+  if (!reduced)
+    return "";
+  return " | Item fixing: " + std::to_string(fixed_in.size()) + " in, " +
+         std::to_string(num_fixed_out) + " out (" +
+         std::to_string(num_too_heavy) + " over capacity), pallets " +
+         std::to_string(original.size()) + " -> " +
+         std::to_string(residual.size()) + ", capacity " +
+         std::to_string(original_capacity) + " -> " +
+         std::to_string(capacity);
+}
@@ -0,0 +1,92 @@
+#ifndef INSTANCE_REDUCTION_H
+#define INSTANCE_REDUCTION_H
+
+#include <string>
+#include <vector>
+
+#include "../../DataStructures/Pallet.h"
+
+/**
+ * @class InstanceReduction
+ * @brief Variable reduction (item fixing) run before the exact solvers.
+ *
+ * Pallets heavier than the capacity are dropped, and if every pallet fits
+ * those with a positive profit are taken. Zero-profit pallets are left to
+ * the solver, and without fix_in only the all-positive case (a unique
+ * optimum) is fixed. Otherwise, a lower bound z is computed: the greedy
+ * ratio-order fill, or the best single pallet if better. Each pallet j is
+ * then tested with Dantzig (LP relaxation) upper bounds, following
+ * Martello-Toth:
+ * - UB(x_j = 0) < z: every optimal solution takes j, so j is fixed in;
+ * - UB(x_j = 1) < z: no optimal solution takes j, so j is fixed out.
+ *
+ * The bounds are strict, so the set of optimal solutions is unchanged. The
+ * solver runs on the residual pallets with the capacity left after the
+ * fixed-in pallets, and restore() adds those pallets back.
+ *
+ * Time complexity: O(n log n) (one sort, then a binary search per pallet)
+ * Space complexity: O(n)
+ */
+class InstanceReduction {
+private:
+  const std::vector<Pallet> &original; ///< Pallets as given by the caller
+  std::vector<Pallet> residual;        ///< Pallets left to the solver
+  std::vector<unsigned int> fixed_in;  ///< Input positions fixed in
+  unsigned int original_capacity = 0;  ///< Capacity as given by the caller
+  unsigned int capacity = 0;           ///< Capacity left to the solver
+  unsigned long long fixed_profit = 0; ///< Profit of the fixed-in pallets
+  unsigned int num_fixed_out = 0;      ///< Pallets fixed out (any reason)
+  unsigned int num_too_heavy = 0;      ///< Pallets heavier than the capacity
+  bool reduced = false;                ///< True if any pallet was fixed
+
+public:
+  /**
+   * @brief Construct a new InstanceReduction object and reduce the instance.
+   * @param pallets List of pallets (must outlive this object)
+   * @param capacity Truck capacity
+   * @param fix_in If false, only pallets that are in no optimal solution are
+   * removed. Use false when ties are broken by the ids of the whole
+   * selection (lexicographical order, draw condition in BF and BT), which
+   * fixed-in pallets would shift.
+   * @param enabled If false, the instance is passed through unchanged
+   */
+  InstanceReduction(const std::vector<Pallet> &pallets, unsigned int capacity,
+                    bool fix_in = true, bool enabled = true);
+
+  /**
+   * @brief Get the residual pallets, in input order.
+   * @return Residual pallets (the original list if nothing was fixed)
+   */
+  const std::vector<Pallet> &get_pallets() const {
+    return reduced ? residual : original;
+  }
+
+  /**
+   * @brief Get the capacity left for the residual pallets.
+   * @return Residual capacity
+   */
+  unsigned int get_capacity() const { return capacity; }
+
+  /**
+   * @brief Get the total profit of the pallets fixed in.
+   * @return Profit to add to the residual solution (exact, 64 bits)
+   */
+  unsigned long long get_fixed_profit() const { return fixed_profit; }
+
+  /**
+   * @brief Adds the fixed-in pallets to a residual solution and lists the
+   * selection in input order, using the caller's pallet objects.
+   * @param used_pallets Residual solution in, full solution out
+   * @details
+   * Time complexity: O(n log n)
+   */
+  void restore(std::vector<Pallet> &used_pallets) const;
+
+  /**
+   * @brief Describes the reduction for result messages.
+   * @return " | Item fixing: ..." or an empty string if nothing was fixed
+   */
+  std::string describe() const;
+};
+
+#endif // INSTANCE_REDUCTION_H
@@ -0,0 +1,214 @@
+#ifndef SOLVE_ARENA_H
+#define SOLVE_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class SolveArena
+ * @brief Monotonic scratch memory of one solve.
+ *
+ * allocate() bumps an offset inside the current heap block and only goes to
+ * the heap when no retained block has room. Nothing is freed individually:
+ * a Scope rewinds the arena to where it was when the scope opened, and the
+ * blocks themselves are released in one shot when the arena is destroyed
+ * (or by release()). A solver that opens a Scope per node or per subset
+ * therefore stops touching the heap once its largest scratch request has
+ * been served.
+ *
+ * Only trivially destructible types may be placed in the arena: no
+ * destructor is ever run. An arena is used by one thread, like SolveBudget.
+ */
+class SolveArena {
+public:
+  /// Size of the first heap block, in bytes (later blocks double)
+  static constexpr std::size_t DEFAULT_BLOCK_SIZE = 4096;
+
+  /**
+   * @struct Marker
+   * @brief Position in the arena, restored by rewind().
+   */
+  struct Marker {
+    std::size_t block; ///< Index of the current block
+    std::size_t used;  ///< Bytes used in that block
+  };
+
+  /**
+   * @class Scope
+   * @brief Rewinds the arena to its position at construction when destroyed.
+   */
+  class Scope {
+  private:
+    SolveArena &arena;
+    Marker marker;
+
+  public:
+    explicit Scope(SolveArena &arena) : arena(arena), marker(arena.mark()) {}
+    ~Scope() { arena.rewind(marker); }
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+  };
+
+private:
+  /**
+   * @struct Block
+   * @brief One heap allocation owned by the arena.
+   */
+  struct Block {
+    std::unique_ptr<unsigned char[]> data; ///< Storage
+    std::size_t size;                      ///< Bytes in data
+  };
+
+  std::vector<Block> blocks;       ///< Retained blocks, in use order
+  std::size_t current = 0;         ///< Index of the block being filled
+  std::size_t used = 0;            ///< Bytes used in the current block
+  std::size_t next_block_size;     ///< Size of the next block to allocate
+  std::size_t bytes_served = 0;    ///< Bytes handed out (with padding)
+  std::size_t allocations = 0;     ///< Number of allocate() calls served
+  std::size_t heap_allocations = 0; ///< Number of blocks taken from the heap
+  std::size_t heap_bytes = 0;       ///< Bytes currently held in blocks
+
+  // Offset of the first `align`-aligned byte at or after `used` in `block`
+  static std::size_t align_up(const Block &block, std::size_t used,
+                              std::size_t align) {
+    auto address = reinterpret_cast<std::uintptr_t>(block.data.get()) + used;
+    auto aligned = (address + align - 1) & ~(std::uintptr_t(align) - 1);
+    return used + (aligned - address);
+  }
+
+  // Makes `current` a block with room for `bytes` at `align`: reuses the next
+  // retained block when it is large enough, otherwise frees the retained
+  // blocks after the current one and allocates a larger block
+  void grow(std::size_t bytes, std::size_t align) {
+    std::size_t next = blocks.empty() ? 0 : current + 1;
+    if (next < blocks.size() && bytes + align <= blocks[next].size) {
+      current = next;
+      used = 0;
+      return;
+    }
+    for (std::size_t b = next; b < blocks.size(); ++b)
+      heap_bytes -= blocks[b].size;
+    blocks.resize(next);
+    while (next_block_size < bytes + align)
+      next_block_size *= 2;
+    blocks.push_back(
+        {std::make_unique<unsigned char[]>(next_block_size), next_block_size});
+    heap_allocations++;
+    heap_bytes += next_block_size;
+    next_block_size *= 2;
+    current = next;
+    used = 0;
+  }
+
+public:
+  /**
+   * @brief Construct a new SolveArena object (no memory is taken until the
+   * first allocation).
+   * @param block_size Size of the first heap block in bytes
+   */
+  explicit SolveArena(std::size_t block_size = DEFAULT_BLOCK_SIZE)
+      : next_block_size(block_size > 0 ? block_size : 1) {}
+
+  SolveArena(const SolveArena &) = delete;
+  SolveArena &operator=(const SolveArena &) = delete;
+
+  /**
+   * @brief Hands out `bytes` bytes aligned to `align`.
+   * @param bytes Size of the request
+   * @param align Alignment (power of two)
+   * @return Pointer valid until the arena is rewound past it or released
+   */
+  void *allocate(std::size_t bytes, std::size_t align) {
+    std::size_t offset =
+        blocks.empty() ? 0 : align_up(blocks[current], used, align);
+    if (blocks.empty() || offset + bytes > blocks[current].size) {
+      grow(bytes, align);
+      offset = align_up(blocks[current], used, align);
+    }
+    bytes_served += offset + bytes - used;
+    allocations++;
+    used = offset + bytes;
+    return blocks[current].data.get() + offset;
+  }
+
+  /**
+   * @brief Hands out uninitialized storage for `count` objects of type T.
+   * @param count Number of objects
+   * @return Pointer to the first object
+   */
+  template <class T> T *allocate(std::size_t count) {
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "SolveArena never runs destructors");
+    return static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+  }
+
+  /**
+   * @brief Current position, to be restored with rewind().
+   * @return Marker of the next allocation
+   */
+  Marker mark() const { return {current, used}; }
+
+  /**
+   * @brief Makes everything allocated after `marker` available again. The
+   * blocks are kept for reuse.
+   * @param marker Position returned by mark()
+   */
+  void rewind(Marker marker) {
+    current = marker.block;
+    used = marker.used;
+  }
+
+  /**
+   * @brief Returns every block to the heap (the counters are kept).
+   */
+  void release() {
+    blocks.clear();
+    current = 0;
+    used = 0;
+    heap_bytes = 0;
+  }
+
+  /**
+   * @brief Get the number of allocate() calls served.
+   * @return Number of allocations
+   */
+  std::size_t get_allocations() const { return allocations; }
+
+  /**
+   * @brief Get the number of bytes handed out, alignment padding included.
+   * @return Bytes served (counts rewound memory again when reused)
+   */
+  std::size_t get_bytes_served() const { return bytes_served; }
+
+  /**
+   * @brief Get the number of blocks taken from the heap.
+   * @return Heap allocations made by the arena
+   */
+  std::size_t get_heap_allocations() const { return heap_allocations; }
+
+  /**
+   * @brief Get the number of bytes currently held from the heap.
+   * @return Total size of the retained blocks
+   */
+  std::size_t get_heap_bytes() const { return heap_bytes; }
+
+  /**
+   * @brief Summarizes the counters for result messages.
+   * @return Empty if nothing was allocated, otherwise
+   * " | Scratch: A allocations, B B served, H heap blocks (K B)"
+   */
+  std::string describe() const {
+    if (allocations == 0)
+      return "";
+    return " | Scratch: " + std::to_string(allocations) + " allocations, " +
+           std::to_string(bytes_served) + " B served, " +
+           std::to_string(heap_allocations) + " heap blocks (" +
+           std::to_string(heap_bytes) + " B)";
+  }
+};
+
+#endif // SOLVE_ARENA_H
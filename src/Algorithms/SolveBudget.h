@@ -0,0 +1,163 @@
+#ifndef SOLVE_BUDGET_H
+#define SOLVE_BUDGET_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+/**
+ * @class CancellationToken
+ * @brief Flag that another thread sets to stop a running solver.
+ *
+ * The token is owned by the caller and must outlive the solve. cancel() may
+ * be called from any thread; the solver sees it at its next budget poll.
+ */
+class CancellationToken {
+private:
+  std::atomic<bool> cancelled{false}; ///< Set once cancel() is called
+
+public:
+  /**
+   * @brief Requests that every solve using this token stops.
+   */
+  void cancel() { cancelled.store(true, std::memory_order_relaxed); }
+
+  /**
+   * @brief Clears the request so the token can be reused.
+   */
+  void reset() { cancelled.store(false, std::memory_order_relaxed); }
+
+  /**
+   * @brief Checks whether cancellation was requested.
+   * @return True after cancel()
+   */
+  bool is_cancelled() const {
+    return cancelled.load(std::memory_order_relaxed);
+  }
+};
+
+/**
+ * @class SolveBudget
+ * @brief Time limit and cancellation state of one solve.
+ *
+ * Solvers report work with tick(units). The clock and the cancellation token
+ * are only consulted once `interval` units have been consumed, so a tick in
+ * an inner loop costs a decrement and a branch. Once the budget is exhausted,
+ * every later tick() returns true at once, which replaces the hand-threaded
+ * `deadline` / `bool &timed_out` pair.
+ *
+ * A budget is used by one thread. Parallel solvers poll it from a single
+ * thread and share the outcome through their own synchronization.
+ */
+class SolveBudget {
+public:
+  /// Default number of work units between two clock reads
+  static constexpr unsigned int DEFAULT_INTERVAL = 1024;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  Clock::time_point start;             ///< Time the budget was (re)started
+  Clock::time_point deadline;          ///< Time the budget expires
+  unsigned int timeout_ms;             ///< Time limit, for messages
+  const CancellationToken *token;      ///< External cancellation (optional)
+  unsigned int interval;               ///< Work units between polls
+  unsigned long long countdown;        ///< Work units left before next poll
+  bool exhausted = false;              ///< True once the solve must stop
+  bool cancelled = false;              ///< True if stopped by the token
+
+public:
+  /**
+   * @brief Construct a new SolveBudget object, starting the clock.
+   * @param timeout_ms Time limit in milliseconds
+   * @param token Cancellation token (nullptr if the solve cannot be
+   * cancelled)
+   * @param interval Work units between two polls of the clock and token
+   */
+  explicit SolveBudget(unsigned int timeout_ms,
+                       const CancellationToken *token = nullptr,
+                       unsigned int interval = DEFAULT_INTERVAL)
+      : start(Clock::now()),
+        deadline(start + std::chrono::milliseconds(timeout_ms)),
+        timeout_ms(timeout_ms), token(token),
+        interval(interval > 0 ? interval : 1), countdown(this->interval) {}
+
+  /**
+   * @brief Consumes work units, polling once the interval is used up.
+   * @param units Work done since the last tick
+   * @return True if the solve must stop
+   */
+  bool tick(unsigned long long units = 1) {
+    if (exhausted)
+      return true;
+    if (countdown > units) {
+      countdown -= units;
+      return false;
+    }
+    return poll();
+  }
+
+  /**
+   * @brief Checks the clock and the token now, regardless of the interval.
+   * @return True if the solve must stop
+   */
+  bool poll() {
+    if (exhausted)
+      return true;
+    countdown = interval;
+    if (token != nullptr && token->is_cancelled()) {
+      cancelled = true;
+      exhausted = true;
+    } else if (Clock::now() > deadline) {
+      exhausted = true;
+    }
+    return exhausted;
+  }
+
+  /**
+   * @brief Checks whether an earlier tick or poll stopped the solve.
+   * @return True once the budget is exhausted (no clock read)
+   */
+  bool is_exhausted() const { return exhausted; }
+
+  /**
+   * @brief Checks whether the solve was stopped by the token.
+   * @return True if cancelled rather than timed out
+   */
+  bool is_cancelled() const { return cancelled; }
+
+  /**
+   * @brief Starts a new time window of timeout_ms from now. A cancellation
+   * stays in effect.
+   * @param timeout_ms New time limit in milliseconds
+   */
+  void restart(unsigned int timeout_ms) {
+    this->timeout_ms = timeout_ms;
+    start = Clock::now();
+    deadline = start + std::chrono::milliseconds(timeout_ms);
+    countdown = interval;
+    exhausted = cancelled;
+  }
+
+  /**
+   * @brief Get the time limit of the current window (from construction or
+   * the last restart()).
+   * @return Time limit in milliseconds
+   */
+  unsigned int get_timeout_ms() const { return timeout_ms; }
+
+  /**
+   * @brief Describes why the solve stopped, for result messages.
+   * @return "Timeout after N ms." or "Cancelled after N ms."
+   */
+  std::string stop_reason() const {
+    if (!cancelled)
+      return "Timeout after " + std::to_string(timeout_ms) + " ms.";
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       Clock::now() - start)
+                       .count();
+    return "Cancelled after " + std::to_string(elapsed) + " ms.";
+  }
+};
+
+#endif // SOLVE_BUDGET_H
@@ -113,6 +113,76 @@ void BatchInputManager::generate_output_file(std::string &filename,
   file.close();
 }
 
+void BatchInputManager::generate_sweep_output_files(
+    const std::vector<CapacityQuery> &queries, const CapacitySweep &sweep,
+    const std::string &message) {
+  std::string output_dir = Utils::get_absolute_dir("/output");
+  std::string output_file = output_dir + "/dp_capacity_sweep.txt";
+  std::ofstream file(output_file);
+  if (!file.is_open()) {
+    std::cerr << "ERROR: Could not open output file: " << output_file
+              << std::endl;
+    return;
+  }
+  // Empty after a timeout: only the message is written
+  for (std::size_t k = 0; k < sweep.profits.size(); ++k) {
+    file << "Truck " << k + 1 << ": capacity " << queries[k].capacity
+         << "\n";
+    if (!sweep.used_pallets[k].empty()) {
+      unsigned int total_weight = 0;
+      file << "id, profit, weight\n";
+      for (const auto &pallet : sweep.used_pallets[k]) {
+        file << pallet.get_id() << ", " << pallet.get_profit() << ", "
+             << pallet.get_weight() << "\n";
+        total_weight += pallet.get_weight();
+      }
+      file << "Total Weight: " << total_weight << "\n";
+    }
+    file << "Maximum Profit: " << sweep.profits[k] << "\n\n";
+  }
+  file << message << "\n";
+  file.close();
+
+  if (sweep.curve.empty())
+    return;
+  std::string curve_file = output_dir + "/capacity_curve.csv";
+  std::ofstream curve(curve_file);
+  if (!curve.is_open()) {
+    std::cerr << "ERROR: Could not open output file: " << curve_file
+              << std::endl;
+    return;
+  }
+  curve << "capacity, profit\n";
+  for (std::size_t w = 0; w < sweep.curve.size(); ++w)
+    curve << w << ", " << sweep.curve[w] << "\n";
+  curve.close();
+}
+
+void BatchInputManager::ask_dp_tie_breaking(const std::string &algorithm,
+                                            bool &draw, bool &lex) {
+  draw = false;
+  lex = false;
+  // Ask user for draw condition
+  char draw_condition = 'n';
+  std::cout << "Enable draw condition for " << algorithm << "? (y/N): ";
+  std::string input_draw;
+  std::getline(std::cin, input_draw);
+  if (!input_draw.empty())
+    draw_condition = std::tolower(input_draw[0]);
+  draw = (draw_condition == 'y');
+  // Lexicographical order
+  if (draw) {
+    char lex_choice = 'n';
+    std::cout << "Enable lexicographical tie-breaking for " << algorithm
+              << "? (y/N): ";
+    std::string input_lex;
+    std::getline(std::cin, input_lex);
+    if (!input_lex.empty())
+      lex_choice = std::tolower(input_lex[0]);
+    lex = (lex_choice == 'y');
+  }
+}
+
 void BatchInputManager::processInput() {
   BatchUtils::clear_terminal();
   std::string prompt = "Choose algorithm (empty line to exit): ";
@@ -122,7 +192,22 @@ void BatchInputManager::processInput() {
                                         "BB",
                                         "DP-VECTOR",
                                         "DP-HASHMAP",
+                                        "DP-HASHMAP-ITERATIVE",
+                                        "DP-FLAT",
+                                        "DP-BITSET",
+                                        "DP-PARALLEL",
+                                        "DP-TILED",
+                                        "DP-SUBSET-SUM",
+                                        "DP-WEIGHT-CLASS",
+                                        "DP-PROFIT-INDEXED",
+                                        "DP-OUT-OF-CORE",
+                                        "DP-AUTO",
+                                        "DP-CAPACITY-SWEEP",
                                         "DP-OPTIMIZED",
+                                        "DP-SIMD",
+                                        "DP-DIVIDE-CONQUER",
+                                        "DP-PARETO",
+                                        "DP-CORE",
                                         "GREEDY-APPROX",
                                         "ILP-CPP",
                                         "ILP-PY"};
@@ -159,25 +244,7 @@ void BatchInputManager::processInput() {
     case 4: {
       // DP-VECTOR
       bool draw = false, lex = false;
-      // Ask user for draw condition
-      char draw_condition = 'n';
-      std::cout << "Enable draw condition for DP-VECTOR? (y/N): ";
-      std::string input_draw;
-      std::getline(std::cin, input_draw);
-      if (!input_draw.empty())
-        draw_condition = std::tolower(input_draw[0]);
-      draw = (draw_condition == 'y');
-      // Lexicographical order
-      if (draw) {
-        char lex_choice = 'n';
-        std::cout
-            << "Enable lexicographical tie-breaking for DP-VECTOR? (y/N): ";
-        std::string input;
-        std::getline(std::cin, input);
-        if (!input.empty())
-          lex_choice = std::tolower(input[0]);
-        lex = (lex_choice == 'y');
-      }
+      ask_dp_tie_breaking("DP-VECTOR", draw, lex);
       filename = "dp_vector.txt";
       max_profit = DynamicProgramming(draw, lex).dp_solve(
           pallets, truck, used_pallets, TableType::Vector, message, timeout_ms);
@@ -187,25 +254,7 @@ void BatchInputManager::processInput() {
     case 5: {
       // DP-HASHMAP
       bool draw = false, lex = false;
-      // Ask user for draw condition
-      char draw_condition = 'n';
-      std::cout << "Enable draw condition for DP-HASHMAP? (y/N): ";
-      std::string input_draw;
-      std::getline(std::cin, input_draw);
-      if (!input_draw.empty())
-        draw_condition = std::tolower(input_draw[0]);
-      draw = (draw_condition == 'y');
-      // Lexicographical order
-      if (draw) {
-        char lex_choice = 'n';
-        std::cout
-            << "Enable lexicographical tie-breaking for DP-HASHMAP? (y/N): ";
-        std::string input_lex;
-        std::getline(std::cin, input_lex);
-        if (!input_lex.empty())
-          lex_choice = std::tolower(input_lex[0]);
-        lex = (lex_choice == 'y');
-      }
+      ask_dp_tie_breaking("DP-HASHMAP", draw, lex);
       filename = "dp_hashmap.txt";
       max_profit = DynamicProgramming(draw, lex).dp_solve(
           pallets, truck, used_pallets, TableType::HashMap, message,
@@ -213,25 +262,261 @@ void BatchInputManager::processInput() {
       generate_output_file(filename, used_pallets, max_profit, message);
       break;
     }
-    case 6:
+    case 6: {
+      // DP-HASHMAP-ITERATIVE
+      bool draw = false, lex = false;
+      ask_dp_tie_breaking("DP-HASHMAP-ITERATIVE", draw, lex);
+      filename = "dp_hashmap_iterative.txt";
+      max_profit = DynamicProgramming(draw, lex).dp_solve(
+          pallets, truck, used_pallets, TableType::IterativeHashMap, message,
+          timeout_ms);
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    }
+    case 7: {
+      // DP-FLAT
+      bool draw = false, lex = false;
+      ask_dp_tie_breaking("DP-FLAT", draw, lex);
+      filename = "dp_flat.txt";
+      max_profit = DynamicProgramming(draw, lex).dp_solve(
+          pallets, truck, used_pallets, TableType::Flat, message, timeout_ms);
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    }
+    case 8: {
+      // DP-BITSET
+      bool draw = false, lex = false;
+      ask_dp_tie_breaking("DP-BITSET", draw, lex);
+      filename = "dp_bitset.txt";
+      max_profit = DynamicProgramming(draw, lex).dp_solve(
+          pallets, truck, used_pallets, TableType::Bitset, message,
+          timeout_ms);
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    }
+    case 9: {
+      // DP-PARALLEL
+      bool draw = false, lex = false;
+      ask_dp_tie_breaking("DP-PARALLEL", draw, lex);
+      unsigned int threads = 0;
+      std::cout << "Number of threads for DP-PARALLEL (empty for all cores): ";
+      std::string input_threads;
+      std::getline(std::cin, input_threads);
+      std::string trimmed = ParserUtils::trim(input_threads);
+      unsigned long long value = 0;
+      if (BatchUtils::parse_unsigned(trimmed, UINT_MAX, value))
+        threads = static_cast<unsigned int>(value);
+      else if (!trimmed.empty())
+        std::cerr << "Ignoring invalid thread count \"" << trimmed
+                  << "\": using all cores.\n";
+      DynamicProgramming dp(draw, lex);
+      dp.set_num_threads(threads);
+      filename = "dp_parallel.txt";
+      max_profit = dp.dp_solve(pallets, truck, used_pallets,
+                               TableType::Parallel, message, timeout_ms);
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    }
+    case 10: {
+      // DP-TILED
+      bool draw = false, lex = false;
+      ask_dp_tie_breaking("DP-TILED", draw, lex);
+      unsigned int items = 0, width = 0;
+      std::cout << "Pallets per block for DP-TILED (empty for automatic): ";
+      std::string input_items;
+      std::getline(std::cin, input_items);
+      std::string trimmed = ParserUtils::trim(input_items);
+      unsigned long long value = 0;
+      if (BatchUtils::parse_unsigned(trimmed, UINT_MAX, value))
+        items = static_cast<unsigned int>(value);
+      else if (!trimmed.empty())
+        std::cerr << "Ignoring invalid block size \"" << trimmed
+                  << "\": using automatic.\n";
+      std::cout << "Capacity cells per tile for DP-TILED (empty for "
+                   "automatic): ";
+      std::string input_width;
+      std::getline(std::cin, input_width);
+      trimmed = ParserUtils::trim(input_width);
+      if (BatchUtils::parse_unsigned(trimmed, UINT_MAX, value))
+        width = static_cast<unsigned int>(value);
+      else if (!trimmed.empty())
+        std::cerr << "Ignoring invalid tile width \"" << trimmed
+                  << "\": using automatic.\n";
+      DynamicProgramming dp(draw, lex);
+      dp.set_tiling(items, width);
+      filename = "dp_tiled.txt";
+      max_profit = dp.dp_solve(pallets, truck, used_pallets, TableType::Tiled,
+                               message, timeout_ms);
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    }
+    case 11: {
+      // DP-SUBSET-SUM
+      bool draw = false, lex = false;
+      ask_dp_tie_breaking("DP-SUBSET-SUM", draw, lex);
+      filename = "dp_subset_sum.txt";
+      max_profit = DynamicProgramming(draw, lex).dp_solve(
+          pallets, truck, used_pallets, TableType::SubsetSum, message,
+          timeout_ms);
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    }
+    case 12: {
+      // DP-WEIGHT-CLASS
+      bool draw = false, lex = false;
+      ask_dp_tie_breaking("DP-WEIGHT-CLASS", draw, lex);
+      filename = "dp_weight_class.txt";
+      max_profit = DynamicProgramming(draw, lex).dp_solve(
+          pallets, truck, used_pallets, TableType::WeightClass, message,
+          timeout_ms);
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    }
+    case 13: {
+      // DP-PROFIT-INDEXED
+      bool draw = false, lex = false;
+      ask_dp_tie_breaking("DP-PROFIT-INDEXED", draw, lex);
+      filename = "dp_profit_indexed.txt";
+      max_profit = DynamicProgramming(draw, lex).dp_solve(
+          pallets, truck, used_pallets, TableType::ProfitIndexed, message,
+          timeout_ms);
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    }
+    case 14: {
+      // DP-OUT-OF-CORE
+      bool draw = false, lex = false;
+      ask_dp_tie_breaking("DP-OUT-OF-CORE", draw, lex);
+      std::cout << "Scratch directory for DP-OUT-OF-CORE (empty for the "
+                   "system temporary directory): ";
+      std::string input_directory;
+      std::getline(std::cin, input_directory);
+      DynamicProgramming dp(draw, lex);
+      dp.set_scratch_directory(ParserUtils::trim(input_directory));
+      filename = "dp_out_of_core.txt";
+      try {
+        max_profit = dp.dp_solve(pallets, truck, used_pallets,
+                                 TableType::OutOfCore, message, timeout_ms);
+      } catch (const std::runtime_error &e) {
+        used_pallets.clear();
+        max_profit = 0;
+        message = "[DP (Out-of-Core Bitset Table)] " + std::string(e.what());
+      }
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    }
+    case 15: {
+      // DP-AUTO
+      bool draw = false, lex = false;
+      ask_dp_tie_breaking("DP-AUTO", draw, lex);
+      std::size_t budget_mb = 0;
+      std::cout << "Memory budget for DP-AUTO in MB (empty for no limit): ";
+      std::string input_budget;
+      std::getline(std::cin, input_budget);
+      std::string trimmed = ParserUtils::trim(input_budget);
+      unsigned long long value = 0;
+      // The budget is converted to bytes: keep budget_mb << 20 in range
+      if (BatchUtils::parse_unsigned(trimmed, SIZE_MAX >> 20, value))
+        budget_mb = static_cast<std::size_t>(value);
+      else if (!trimmed.empty())
+        std::cerr << "Ignoring invalid memory budget \"" << trimmed
+                  << "\": using no limit.\n";
+      DynamicProgramming dp(draw, lex);
+      dp.set_memory_budget(budget_mb << 20);
+      filename = "dp_auto.txt";
+      try {
+        max_profit = dp.dp_solve(pallets, truck, used_pallets,
+                                 TableType::Auto, message, timeout_ms);
+      } catch (const std::runtime_error &e) {
+        used_pallets.clear();
+        max_profit = 0;
+        message = "[DP (Auto)] " + std::string(e.what());
+      }
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    }
+    case 16: {
+      // DP-CAPACITY-SWEEP
+      bool draw = false, lex = false;
+      ask_dp_tie_breaking("DP-CAPACITY-SWEEP", draw, lex);
+      std::cout << "Truck capacities for DP-CAPACITY-SWEEP, separated by "
+                   "commas (empty for the dataset truck): ";
+      std::string input_capacities;
+      std::getline(std::cin, input_capacities);
+      std::cout << "Reconstruct the selected pallets of every truck? (Y/n): ";
+      std::string input_reconstruct;
+      std::getline(std::cin, input_reconstruct);
+      bool reconstruct = input_reconstruct.empty() ||
+                         std::tolower(input_reconstruct[0]) != 'n';
+      std::vector<CapacityQuery> queries;
+      for (const std::string &field :
+           ParserUtils::split(input_capacities, ',')) {
+        std::string trimmed = ParserUtils::trim(field);
+        unsigned long long value = 0;
+        if (BatchUtils::parse_unsigned(trimmed, UINT_MAX, value))
+          queries.push_back({static_cast<unsigned int>(value), reconstruct});
+        else if (!trimmed.empty())
+          std::cerr << "Skipping invalid capacity \"" << trimmed << "\".\n";
+      }
+      if (queries.empty())
+        queries.push_back({truck.get_capacity(), reconstruct});
+      CapacitySweep sweep;
+      try {
+        max_profit = DynamicProgramming(draw, lex).dp_capacity_sweep(
+            pallets, queries, sweep, message, timeout_ms);
+      } catch (const std::bad_alloc &) {
+        // The curve and rows span the largest capacity
+        sweep = CapacitySweep();
+        max_profit = 0;
+        message = "[DP (Capacity Sweep)] Not enough memory for the largest "
+                  "capacity.";
+      }
+      generate_sweep_output_files(queries, sweep, message);
+      break;
+    }
+    case 17:
       filename = "dp_optimized.txt";
       max_profit =
           DynamicProgramming().dp_solve(pallets, truck, message, timeout_ms);
       generate_output_file(filename, used_pallets, max_profit, message);
       break;
-    case 7:
+    case 18:
+      filename = "dp_simd.txt";
+      max_profit = DynamicProgramming().dp_solve_simd(pallets, truck, message,
+                                                      timeout_ms);
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    case 19:
+      filename = "dp_divide_conquer.txt";
+      max_profit = DynamicProgramming().dp_solve_divide_and_conquer(
+          pallets, truck, used_pallets, message, timeout_ms);
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    case 20:
+      filename = "dp_pareto.txt";
+      max_profit = DynamicProgramming().dp_solve_pareto(
+          pallets, truck, used_pallets, message, timeout_ms);
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    case 21:
+      filename = "dp_core.txt";
+      max_profit = ExpandingCore().core_solve(pallets, truck, used_pallets,
+                                              message, timeout_ms);
+      generate_output_file(filename, used_pallets, max_profit, message);
+      break;
+    case 22:
       filename = "greedy_approx.txt";
       max_profit = Greedy().approx_solve(pallets, truck, used_pallets, message,
                                          timeout_ms);
       generate_output_file(filename, used_pallets, max_profit, message);
       break;
-    case 8:
+    case 23:
       filename = "ilp_cpp.txt";
       max_profit = IntegerLinearProgramming().solve_ilp_cpp(
           pallets, truck, used_pallets, message, timeout_ms);
       generate_output_file(filename, used_pallets, max_profit, message);
       break;
-    case 9:
+    case 24:
       filename = "ilp_py.txt";
       max_profit = ILPBridgePy().solve_ilp_py(pallets, truck, used_pallets,
                                               message, timeout_ms);
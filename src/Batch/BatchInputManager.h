@@ -4,9 +4,13 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <climits>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <new>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -15,6 +19,7 @@
 #include "../Algorithms/BB/BranchAndBound.h"
 #include "../Algorithms/BF/BruteForce.h"
 #include "../Algorithms/DP/DynamicProgramming.h"
+#include "../Algorithms/DP/ExpandingCore.h"
 #include "../Algorithms/ILP/ILPBridgePy.h"
 #include "../Algorithms/ILP/IntegerLinearProgramming.h"
 #include "../DataStructures/Pallet.h"
@@ -44,6 +49,28 @@ class BatchInputManager {
    void generate_output_file(std::string &filename,
                              std::vector<Pallet> &used_pallets,
                              unsigned int &max_profit, std::string &message);
+
+   /**
+    * @brief Generates the output files of a capacity sweep: the answer for
+    * every truck (dp_capacity_sweep.txt) and the profit for every capacity
+    * (capacity_curve.csv).
+    * @param queries Trucks of the sweep
+    * @param sweep Answers of the sweep
+    * @param message Status and timing info
+    */
+   void generate_sweep_output_files(const std::vector<CapacityQuery> &queries,
+                                    const CapacitySweep &sweep,
+                                    const std::string &message);
+
+   /**
+    * @brief Asks the user whether to enable the draw condition and
+    * lexicographical tie-breaking for a DP algorithm.
+    * @param algorithm Name of the algorithm shown in the prompt
+    * @param draw Output: true if the draw condition is enabled
+    * @param lex Output: true if lexicographical tie-breaking is enabled
+    */
+   void ask_dp_tie_breaking(const std::string &algorithm, bool &draw,
+                            bool &lex);
    std::vector<Pallet> &pallets; ///< Reference to the vector of pallets
    Truck &truck;                 ///< Reference to the truck object
    unsigned int timeout_ms =
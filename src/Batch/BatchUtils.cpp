@@ -35,4 +35,19 @@ int get_menu_choice(const std::vector<std::string>& options,
               << options.size() << ".\n";
   }
 }
+
+bool parse_unsigned(const std::string& input, unsigned long long max,
+                    unsigned long long& value) {
+  if (input.empty()) return false;
+  unsigned long long result = 0;
+  for (char c : input) {
+    if (c < '0' || c > '9') return false;
+    unsigned long long digit = c - '0';
+    // result * 10 + digit > max, without overflowing
+    if (digit > max || result > (max - digit) / 10) return false;
+    result = result * 10 + digit;
+  }
+  value = result;
+  return true;
+}
 }  // namespace BatchUtils
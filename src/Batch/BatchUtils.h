@@ -40,6 +40,17 @@ std::string get_absolute_dir(std::string path);
  */
 int get_menu_choice(const std::vector<std::string>& options,
                     const std::string& prompt);
+
+/**
+ * @brief Parses a non-negative integer typed by the user. Unlike a stod
+ * check, signs, decimals, exponents and out-of-range values are rejected.
+ * @param input Input string (already trimmed)
+ * @param max Largest accepted value
+ * @param value Output: parsed value (unchanged on failure)
+ * @return True if input is all digits and at most max
+ */
+bool parse_unsigned(const std::string& input, unsigned long long max,
+                    unsigned long long& value);
 }  // namespace BatchUtils
 
 #endif  // BATCH_UTILS_H